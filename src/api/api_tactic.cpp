@@ -58,6 +58,8 @@ extern "C" {
             RETURN_Z3(nullptr);
         }
         tactic * new_t = t->mk(mk_c(c)->m());
+        if (tactic_profiler::enabled())
+            new_t = profile_tactic(name, new_t);
         RETURN_TACTIC(new_t);
         Z3_CATCH_RETURN(nullptr);
     }
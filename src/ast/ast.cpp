@@ -335,15 +335,6 @@ func_decl::func_decl(symbol const & name, unsigned arity, sort * const * domain,
 //
 // -----------------------------------
 
-static app_flags mk_const_flags() {
-    app_flags r;
-    r.m_depth           = 1;
-    r.m_ground          = true;
-    r.m_has_quantifiers = false;
-    r.m_has_labels      = false;
-    return r;
-}
-
 static app_flags mk_default_app_flags() {
     app_flags r;
     r.m_depth           = 1;
@@ -353,12 +344,11 @@ static app_flags mk_default_app_flags() {
     return r;
 }
 
-app_flags app::g_constant_flags = mk_const_flags();
-
 app::app(func_decl * decl, unsigned num_args, expr * const * args):
     expr(AST_APP),
     m_decl(decl),
-    m_num_args(num_args) {
+    m_num_args(num_args),
+    m_flags(mk_default_app_flags()) {
     for (unsigned i = 0; i < num_args; i++)
         m_args[i] = args[i];
 }
@@ -1436,6 +1426,8 @@ void ast_manager::update_fresh_id(ast_manager const& m) {
 void ast_manager::init() {
     m_int_real_coercions = true;
     m_debug_ref_count = false;
+    m_deferred_gc = false;
+    m_deferred_gc_slice = 64;
     m_fresh_id = 0;
     m_expr_id_gen.reset(0);
     m_decl_id_gen.reset(c_first_decl_id);
@@ -1484,6 +1476,7 @@ static void mark_array_ref(ast_mark& mark, unsigned sz, parameter const * a) {
 ast_manager::~ast_manager() {
     SASSERT(is_format_manager() || !m_family_manager.has_family(symbol("format")));
 
+    set_deferred_gc(false);
     dec_ref(m_bool_sort);
     dec_ref(m_proof_sort);
     dec_ref(m_true);
@@ -1796,6 +1789,8 @@ static void track_id(ast_manager& m, ast* n, unsigned id) {
 #endif
 
 ast * ast_manager::register_node_core(ast * n) {
+    if (!m_deferred_nodes.empty())
+        gc_slice(m_deferred_gc_slice);
     unsigned h = get_node_hash(n);
     n->m_hash = h;
 #ifdef Z3DEBUG
@@ -1851,7 +1846,6 @@ ast * ast_manager::register_node_core(ast * n) {
         unsigned num_args = t->get_num_args();
         if (num_args > 0) {
             app_flags * f     = t->flags();
-            *f = mk_default_app_flags();
             SASSERT(t->is_ground());
             SASSERT(!t->has_quantifiers());
             SASSERT(!t->has_labels());
@@ -1920,71 +1914,103 @@ void ast_manager::delete_node(ast * n) {
     SASSERT(m_ast_table.contains(n));
     m_ast_table.push_erase(n);
 
-    while ((n = m_ast_table.pop_erase())) {
+    if (m_deferred_gc) {
+        // n is on top of the to-be-deleted stack.
+        VERIFY(m_ast_table.pop_erase() == n);
+        m_deferred_nodes.push_back(n);
+        return;
+    }
 
-        CTRACE("del_quantifier", is_quantifier(n), tout << "deleting quantifier " << n->m_id << " " << n << "\n";);
-        TRACE("mk_var_bug", tout << "del_ast: " << " " << n->m_ref_count << "\n";);
-        TRACE("ast_delete_node", tout << mk_bounded_pp(n, *this) << "\n";);
+    while ((n = m_ast_table.pop_erase())) 
+        delete_node_core(n);
+}
 
-        SASSERT(!m_debug_ref_count || !m_debug_free_indices.contains(n->m_id));
+void ast_manager::set_deferred_gc(bool flag, unsigned slice) {
+    m_deferred_gc = flag;
+    m_deferred_gc_slice = std::max(slice, 1u);
+    if (!flag)
+        flush_deferred_gc();
+}
+
+bool ast_manager::gc_slice(unsigned max_nodes) {
+    unsigned num_deleted = 0;
+    while (!m_deferred_nodes.empty() && num_deleted < max_nodes) {
+        ast * n = m_deferred_nodes.back();
+        m_deferred_nodes.pop_back();
+        delete_node_core(n);
+        ++num_deleted;
+        // children whose reference counter dropped to zero were moved to the
+        // to-be-deleted stack of m_ast_table by delete_node_core.
+        ast * c;
+        while ((c = m_ast_table.pop_erase()))
+            m_deferred_nodes.push_back(c);
+    }
+    return m_deferred_nodes.empty();
+}
+
+void ast_manager::delete_node_core(ast * n) {
+    CTRACE("del_quantifier", is_quantifier(n), tout << "deleting quantifier " << n->m_id << " " << n << "\n";);
+    TRACE("mk_var_bug", tout << "del_ast: " << " " << n->m_ref_count << "\n";);
+    TRACE("ast_delete_node", tout << mk_bounded_pp(n, *this) << "\n";);
+
+    SASSERT(!m_debug_ref_count || !m_debug_free_indices.contains(n->m_id));
 
 #ifdef RECYCLE_FREE_AST_INDICES
-        if (!m_debug_ref_count) {
-            if (is_decl(n))
-                m_decl_id_gen.recycle(n->m_id);
-            else
-                m_expr_id_gen.recycle(n->m_id);
-        }
+    if (!m_debug_ref_count) {
+        if (is_decl(n))
+            m_decl_id_gen.recycle(n->m_id);
+        else
+            m_expr_id_gen.recycle(n->m_id);
+    }
 #endif
-        switch (n->get_kind()) {
-        case AST_SORT:
-            if (to_sort(n)->m_info != nullptr && !m_debug_ref_count) {
-                sort_info * info = to_sort(n)->get_info();
-                info->del_eh(*this);
-                dealloc(info);
-            }
-            break;
-        case AST_FUNC_DECL: {
-            func_decl* f = to_func_decl(n);
-            if (f->m_info != nullptr && !m_debug_ref_count) {
-                func_decl_info * info = f->get_info();
-                if (info->is_lambda()) {
-                    push_dec_ref(m_lambda_defs[f]);
-                    m_lambda_defs.remove(f);
-                }
-                info->del_eh(*this);
-                dealloc(info);
-            }
-            push_dec_array_ref(f->get_arity(), f->get_domain());
-            push_dec_ref(f->get_range());
-            break;
-        }
-        case AST_APP: {
-            app* a = to_app(n);
-            push_dec_ref(a->get_decl());
-            push_dec_array_ref(a->get_num_args(), a->get_args());
-            break;
-        }
-        case AST_VAR:
-            push_dec_ref(to_var(n)->get_sort());
-            break;
-        case AST_QUANTIFIER: {
-            quantifier* q = to_quantifier(n);
-            push_dec_array_ref(q->get_num_decls(), q->get_decl_sorts());
-            push_dec_ref(q->get_expr());
-            push_dec_ref(q->get_sort());
-            push_dec_array_ref(q->get_num_patterns(), q->get_patterns());
-            push_dec_array_ref(q->get_num_no_patterns(), q->get_no_patterns());
-            break;
+    switch (n->get_kind()) {
+    case AST_SORT:
+        if (to_sort(n)->m_info != nullptr && !m_debug_ref_count) {
+            sort_info * info = to_sort(n)->get_info();
+            info->del_eh(*this);
+            dealloc(info);
         }
-        default:
-            break;
+        break;
+    case AST_FUNC_DECL: {
+        func_decl* f = to_func_decl(n);
+        if (f->m_info != nullptr && !m_debug_ref_count) {
+            func_decl_info * info = f->get_info();
+            if (info->is_lambda()) {
+                push_dec_ref(m_lambda_defs[f]);
+                m_lambda_defs.remove(f);
+            }
+            info->del_eh(*this);
+            dealloc(info);
         }
-        if (m_debug_ref_count) {
-            m_debug_free_indices.insert(n->m_id,0);
-        }       
-        deallocate_node(n, ::get_node_size(n));
+        push_dec_array_ref(f->get_arity(), f->get_domain());
+        push_dec_ref(f->get_range());
+        break;
+    }
+    case AST_APP: {
+        app* a = to_app(n);
+        push_dec_ref(a->get_decl());
+        push_dec_array_ref(a->get_num_args(), a->get_args());
+        break;
+    }
+    case AST_VAR:
+        push_dec_ref(to_var(n)->get_sort());
+        break;
+    case AST_QUANTIFIER: {
+        quantifier* q = to_quantifier(n);
+        push_dec_array_ref(q->get_num_decls(), q->get_decl_sorts());
+        push_dec_ref(q->get_expr());
+        push_dec_ref(q->get_sort());
+        push_dec_array_ref(q->get_num_patterns(), q->get_patterns());
+        push_dec_array_ref(q->get_num_no_patterns(), q->get_no_patterns());
+        break;
+    }
+    default:
+        break;
     }
+    if (m_debug_ref_count) {
+        m_debug_free_indices.insert(n->m_id,0);
+    }       
+    deallocate_node(n, ::get_node_size(n));
 }
 
 
@@ -684,24 +684,26 @@ struct app_flags {
     unsigned     m_has_quantifiers:1; // application has nested quantifiers.
     unsigned     m_has_labels:1; // application has nested labels.
 };
+static_assert(sizeof(app_flags) == sizeof(unsigned), "app_flags must fit in a single word");
 
 class app : public expr {
     friend class ast_manager;
 
     func_decl *  m_decl;
     unsigned     m_num_args;
+    // remark: the flags occupy the slot that would otherwise be padding between
+    // m_num_args and the (pointer aligned) argument array. So, storing them inline
+    // is free, and applications with arguments don't need an extra trailing word.
+    app_flags    m_flags;
     expr *       m_args[0];
 
-    static app_flags g_constant_flags;
-
-    // remark: store term depth in the end of the app. the depth is only stored if the num_args > 0
     static unsigned get_obj_size(unsigned num_args) {
-        return num_args == 0 ? sizeof(app) : sizeof(app) + num_args * sizeof(expr *) + sizeof(app_flags);
+        return sizeof(app) + num_args * sizeof(expr *);
     }
 
     friend class tmp_app;
 
-    app_flags * flags() const { return m_num_args == 0 ? &g_constant_flags : reinterpret_cast<app_flags*>(const_cast<expr**>(m_args + m_num_args)); }
+    app_flags * flags() const { return const_cast<app_flags*>(&m_flags); }
 
     app(func_decl * decl, unsigned num_args, expr * const * args);
 public:
@@ -1544,6 +1546,9 @@ protected:
     unsigned                  m_fresh_id;
     bool                      m_debug_ref_count;
     u_map<unsigned>           m_debug_free_indices;
+    bool                      m_deferred_gc;        // If true, dead nodes are reclaimed in bounded slices.
+    unsigned                  m_deferred_gc_slice;  // Maximal number of nodes reclaimed per slice.
+    ptr_vector<ast>           m_deferred_nodes;     // Dead nodes (already removed from m_ast_table) waiting to be reclaimed.
     std::fstream*             m_trace_stream;
     bool                      m_trace_stream_owner;
 #ifdef Z3DEBUG
@@ -1679,6 +1684,25 @@ public:
 
     void debug_ref_count() { m_debug_ref_count = true; }
 
+    /**
+       \brief Enable/disable deferred garbage collection.
+
+       When enabled, a node whose reference counter drops to zero is removed
+       from the hash-consing table, but its memory (and the references it holds on its
+       children) is only reclaimed later in slices of at most \c slice nodes.
+       A slice is executed each time a new node is created, and
+       by gc_slice. So, dropping a huge formula does not produce a long pause.
+       Disabling deferred collection reclaims all pending nodes.
+    */
+    void set_deferred_gc(bool flag, unsigned slice = 64);
+    bool deferred_gc() const { return m_deferred_gc; }
+    /**
+       \brief Reclaim at most \c max_nodes dead nodes. Return true if there are no pending dead nodes.
+    */
+    bool gc_slice(unsigned max_nodes);
+    void flush_deferred_gc() { gc_slice(UINT_MAX); }
+    unsigned get_num_deferred_nodes() const { return m_deferred_nodes.size(); }
+
     void inc_ref(ast* n) {
         if (n) {
             n->inc_ref();
@@ -1725,6 +1749,8 @@ protected:
 
     void delete_node(ast * n);
 
+    void delete_node_core(ast * n);
+
     void * allocate_node(unsigned size) {
         return m_alloc.allocate(size);
     }
@@ -87,6 +87,11 @@ public:
     virtual void mk_const(func_decl * f, expr_ref & result);
     virtual void mk_rm_const(func_decl * f, expr_ref & result);
     virtual void mk_uf(func_decl * f, unsigned num, expr * const * args, expr_ref & result);
+    /**
+       \brief Return true if the client supplies the encoding of t, in which case
+       neither t nor its arguments are converted.
+    */
+    virtual bool get_subst(app * t, expr * & result) { return false; }
     void mk_var(unsigned base_inx, sort * srt, expr_ref & result);
 
     void mk_pinf(func_decl * f, expr_ref & result);
@@ -56,6 +56,11 @@ struct fpa2bv_rewriter_cfg : public default_rewriter_cfg {
 
     bool pre_visit(expr * t);
 
+    bool get_subst(expr * s, expr * & t, proof * & t_pr) {
+        t_pr = nullptr;
+        return is_app(s) && m_conv.get_subst(to_app(s), t);
+    }
+
     bool reduce_quantifier(quantifier * old_q,
                            expr * new_body,
                            expr * const * new_patterns,
@@ -29,7 +29,8 @@ struct blaster_cfg {
 
     bool_rewriter & m_rewriter;
     bv_util &       m_util;
-    blaster_cfg(bool_rewriter & r, bv_util & u):m_rewriter(r), m_util(u) {}
+    bool            m_aig;
+    blaster_cfg(bool_rewriter & r, bv_util & u):m_rewriter(r), m_util(u), m_aig(false) {}
 
     ast_manager & m() const { return m_util.get_manager(); }
     numeral power(unsigned n) const { return rational::power_of_two(n); }
@@ -40,10 +41,23 @@ struct blaster_cfg {
         mk_xor(a, tmp, r);
     }
     void mk_iff(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_iff(a, b, r); }
-    void mk_and(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_and(a, b, r); }
+    void mk_and(expr * a, expr * b, expr_ref & r) { 
+        if (!m_aig) {
+            m_rewriter.mk_and(a, b, r); 
+            return;
+        }
+        expr_ref na(m()), nb(m()), t(m());
+        mk_not(a, na);
+        mk_not(b, nb);
+        mk_or(na, nb, t);
+        mk_not(t, r);
+    }
     void mk_and(expr * a, expr * b, expr * c, expr_ref & r) { m_rewriter.mk_and(a, b, c, r); }
     void mk_and(unsigned sz, expr * const * args, expr_ref & r) { m_rewriter.mk_and(sz, args, r); }
-    void mk_or(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_or(a, b, r); }
+    void mk_or(expr * a, expr * b, expr_ref & r) { 
+        if (!m_aig || (!mk_or2(a, b, r) && !mk_or2(b, a, r)))
+            m_rewriter.mk_or(a, b, r); 
+    }
     void mk_or(expr * a, expr * b, expr * c, expr_ref & r) { m_rewriter.mk_or(a, b, c, r); }
     void mk_or(unsigned sz, expr * const * args, expr_ref & r) { m_rewriter.mk_or(sz, args, r); }
     void mk_not(expr * a, expr_ref & r) { m_rewriter.mk_not(a, r); }
@@ -65,6 +79,80 @@ struct blaster_cfg {
     void mk_nand(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_nand(a, b, r); }
     void mk_nor(expr * a, expr * b, expr_ref & r) { m_rewriter.mk_nor(a, b, r); }
     void mk_ge2(expr * a, expr * b, expr * c, expr_ref& r) { m_rewriter.mk_ge2(a, b, c, r); }
+
+    bool is_complement(expr * a, expr * b) const {
+        expr * t;
+        return (m().is_not(a, t) && t == b) || (m().is_not(b, t) && t == a);
+    }
+
+    /**
+       \brief Two-level minimization of (or a b) when a is a gate (Brummayer and Biere, 
+       Local two-level And-Inverter graph minimization without blowup).
+       With and eliminated, gates are either (or x1 .. xn) or (not (or x1 .. xn)).
+       
+       - (or x y) | x  = (or x y)
+       - (or x y) | !x = true
+       - (or x y) | (or !x z) = true
+       - !(or x y) | !x = !x
+       - !(or x y) | x  = x | !y
+       - !(or x y) | !(or x !y) = !x
+    */
+    bool mk_or2(expr * a, expr * b, expr_ref & r) {
+        expr * na, * nb;
+        if (m().is_or(a)) {
+            for (expr * x : *to_app(a)) {
+                if (x == b) {
+                    r = a;
+                    return true;
+                }
+                if (is_complement(x, b)) {
+                    r = m().mk_true();
+                    return true;
+                }
+            }
+            if (m().is_or(b) && to_app(a)->get_num_args() == 2 && to_app(b)->get_num_args() == 2) {
+                for (expr * x : *to_app(a)) 
+                    for (expr * y : *to_app(b)) 
+                        if (is_complement(x, y)) {
+                            r = m().mk_true();
+                            return true;
+                        }
+            }
+            return false;
+        }
+        if (!m().is_not(a, na) || !m().is_or(na))
+            return false;
+        app * g = to_app(na);
+        for (expr * x : *g) {
+            if (is_complement(x, b)) {
+                r = b;
+                return true;
+            }
+        }
+        if (g->get_num_args() != 2)
+            return false;
+        expr * x = g->get_arg(0), * y = g->get_arg(1);
+        if (b == y)
+            std::swap(x, y);
+        if (b == x) {
+            expr_ref ny(m());
+            mk_not(y, ny);
+            m_rewriter.mk_or(x, ny, r);
+            return true;
+        }
+        if (m().is_not(b, nb) && m().is_or(nb) && to_app(nb)->get_num_args() == 2) {
+            expr * u = to_app(nb)->get_arg(0), * v = to_app(nb)->get_arg(1);
+            if (x == v || y == v)
+                std::swap(u, v);
+            if (y == u)
+                std::swap(x, y);
+            if (x == u && is_complement(y, v)) {
+                mk_not(x, r);
+                return true;
+            }
+        }
+        return false;
+    }
 };
 
 class blaster : public bit_blaster_tpl<blaster_cfg> {
@@ -80,6 +168,7 @@ public:
     }
 
     bv_util & butil() { return m_util; }
+    void set_aig(bool f) { m_aig = f; }
 };
 
 struct blaster_rewriter_cfg : public default_rewriter_cfg {
@@ -137,6 +226,7 @@ struct blaster_rewriter_cfg : public default_rewriter_cfg {
         m_blast_mul      = p.get_bool("blast_mul", true);
         m_blast_full     = p.get_bool("blast_full", false);
         m_blast_quant    = p.get_bool("blast_quant", false);
+        m_blaster.set_aig(p.get_bool("blast_aig", false));
         m_blaster.set_max_memory(m_max_memory);
     }
 
@@ -31,6 +31,7 @@ Notes:
 #include "cmd_context/cmd_util.h"
 #include "cmd_context/simplify_cmd.h"
 #include "cmd_context/eval_cmd.h"
+#include "tactic/tactical.h"
 
 class help_cmd : public cmd {
     svector<symbol> m_cmds;
@@ -641,6 +642,7 @@ class get_info_cmd : public cmd {
     symbol   m_all_statistics;
     symbol   m_assertion_stack_levels;
     symbol   m_rlimit;
+    symbol   m_tactic_profile;
 public:
     get_info_cmd():
         cmd("get-info"),
@@ -652,7 +654,8 @@ public:
         m_reason_unknown(":reason-unknown"),
         m_all_statistics(":all-statistics"),
         m_assertion_stack_levels(":assertion-stack-levels"),
-        m_rlimit(":rlimit") {
+        m_rlimit(":rlimit"),
+        m_tactic_profile(":tactic-profile") {
     }
     char const * get_usage() const override { return "<keyword>"; }
     char const * get_descr(cmd_context & ctx) const override { return "get information."; }
@@ -693,6 +696,11 @@ public:
         else if (opt == m_assertion_stack_levels) {
             ctx.regular_stream() << "(:assertion-stack-levels " << ctx.num_scopes() << ")" << std::endl;
         }
+        else if (opt == m_tactic_profile) {
+            ctx.regular_stream() << "(:tactic-profile\n";
+            tactic_profiler::display(ctx.regular_stream());
+            ctx.regular_stream() << ")" << std::endl;
+        }
         else {
             ctx.print_unsupported(opt, m_line, m_pos);
         }
@@ -2011,7 +2011,7 @@ void cmd_context::set_solver_factory(solver_factory * f) {
     }
 }
 
-void cmd_context::display_statistics(bool show_total_time, double total_time) {
+void cmd_context::display_statistics(bool show_total_time, double total_time, bool json) {
     statistics st;
     if (show_total_time)
         st.update("total time", total_time);
@@ -2027,7 +2027,10 @@ void cmd_context::display_statistics(bool show_total_time, double total_time) {
     else if (m_opt) {
         m_opt->collect_statistics(st);
     }
-    st.display_smt2(regular_stream());
+    if (json)
+        st.display_json(regular_stream());
+    else
+        st.display_smt2(regular_stream());
 }
 
 
@@ -427,7 +427,7 @@ public:
     user_tactic_iterator end_user_tactics() const { return m_user_tactic_decls.end(); }
 
     void display_assertions();
-    void display_statistics(bool show_total_time = false, double total_time = 0.0);
+    void display_statistics(bool show_total_time = false, double total_time = 0.0, bool json = false);
     void display_dimacs();
     void reset(bool finalize = false);
     void assert_expr(expr * t);
@@ -88,6 +88,8 @@ void help_tactic(cmd_context & ctx) {
     buf << "- (or-else <tactic>+) tries the given tactics in sequence until one of them succeeds (i.e., the first that doesn't fail).\n";
     buf << "- (par-or <tactic>+) executes the given tactics in parallel until one of them succeeds (i.e., the first that doesn't fail).\n";
     buf << "- (par-then <tactic1> <tactic2>) executes tactic1 and then tactic2 to every subgoal produced by tactic1. All subgoals are processed in parallel.\n";
+    buf << "- (par-shard <tactic>) splits the goal into groups of formulas without common symbols and applies tactic to the groups in parallel.\n";
+    buf << "- (par-share <tactic>+) executes the given tactics in parallel like par-or, the tactics exchange units, equalities and bounds at share points.\n";
     buf << "- (try-for <tactic> <num>) executes the given tactic for at most <num> milliseconds, it fails if the execution takes more than <num> milliseconds.\n";
     buf << "- (if <probe> <tactic> <tactic>) if <probe> evaluates to true, then execute the first tactic. Otherwise execute the second.\n";
     buf << "- (when <probe> <tactic>) shorthand for (if <probe> <tactic> skip).\n";
@@ -447,6 +449,26 @@ static tactic * mk_par(cmd_context & ctx, sexpr * n) {
     return par(args.size(), args.c_ptr());
 }
 
+static tactic * mk_par_share(cmd_context & ctx, sexpr * n) {
+    SASSERT(n->is_composite());
+    unsigned num_children = n->get_num_children();
+    if (num_children < 2)
+        throw cmd_exception("invalid par-share combinator, at least one argument expected", n->get_line(), n->get_pos());
+    if (num_children == 2)
+        return sexpr2tactic(ctx, n->get_child(1));
+    tactic_ref_buffer args;
+    for (unsigned i = 1; i < num_children; i++)
+        args.push_back(sexpr2tactic(ctx, n->get_child(i)));
+    return par_share(args.size(), args.c_ptr());
+}
+
+static tactic * mk_par_shard(cmd_context & ctx, sexpr * n) {
+    SASSERT(n->is_composite());
+    if (n->get_num_children() != 2)
+        throw cmd_exception("invalid par-shard combinator, one argument expected", n->get_line(), n->get_pos());
+    return par_shard(sexpr2tactic(ctx, n->get_child(1)));
+}
+
 static tactic * mk_par_then(cmd_context & ctx, sexpr * n) {
     SASSERT(n->is_composite());
     unsigned num_children = n->get_num_children();
@@ -652,11 +674,58 @@ static tactic * mk_skip_if_failed(cmd_context & ctx, sexpr * n) {
     return skip_if_failed(t);
 }
 
+static tactic * mk_combinator(cmd_context & ctx, sexpr * n, symbol const & cmd_name) {
+    if (cmd_name == "and-then" || cmd_name == "then")
+        return mk_and_then(ctx, n);
+    else if (cmd_name == "or-else")
+        return mk_or_else(ctx, n);
+    else if (cmd_name == "par")
+        return mk_par(ctx, n);
+    else if (cmd_name == "par-or")
+        return mk_par(ctx, n);
+    else if (cmd_name == "par-then")
+        return mk_par_then(ctx, n);
+    else if (cmd_name == "par-share")
+        return mk_par_share(ctx, n);
+    else if (cmd_name == "par-shard")
+        return mk_par_shard(ctx, n);
+    else if (cmd_name == "try-for")
+        return mk_try_for(ctx, n);
+    else if (cmd_name == "repeat")
+        return mk_repeat(ctx, n);
+    else if (cmd_name == "if" || cmd_name == "ite" || cmd_name == "cond")
+        return mk_if(ctx, n);
+    else if (cmd_name == "fail-if")
+        return mk_fail_if(ctx, n);
+    else if (cmd_name == "fail-if-branching")
+        return mk_fail_if_branching(ctx, n);
+    else if (cmd_name == "when")
+        return mk_when(ctx, n);
+    else if (cmd_name == "!" || cmd_name == "using-params" || cmd_name == "with")
+        return mk_using_params(ctx, n);
+    else if (cmd_name == "echo")
+        return mk_echo(ctx, n);
+    else if (cmd_name == "if-no-proofs")
+        return mk_if_no_proofs(ctx, n);
+    else if (cmd_name == "if-no-models")
+        return mk_if_no_models(ctx, n);
+    else if (cmd_name == "if-no-unsat-cores")
+        return mk_if_no_unsat_cores(ctx, n);
+    else if (cmd_name == "skip-if-failed")
+        return mk_skip_if_failed(ctx, n);
+    else
+        throw cmd_exception("invalid tactic, unknown tactic combinator ", cmd_name, n->get_line(), n->get_pos());
+}
+
+static tactic * mk_profiled(symbol const & name, tactic * t) {
+    return tactic_profiler::enabled() ? profile_tactic(name.str().c_str(), t) : t;
+}
+
 tactic * sexpr2tactic(cmd_context & ctx, sexpr * n) {
     if (n->is_symbol()) {
         tactic_cmd * cmd = ctx.find_tactic_cmd(n->get_symbol());
         if (cmd != nullptr)
-            return cmd->mk(ctx.m());
+            return mk_profiled(n->get_symbol(), cmd->mk(ctx.m()));
         sexpr * decl = ctx.find_user_tactic(n->get_symbol());
         if (decl != nullptr)
             return sexpr2tactic(ctx, decl);
@@ -670,42 +739,7 @@ tactic * sexpr2tactic(cmd_context & ctx, sexpr * n) {
         if (!head->is_symbol())
             throw cmd_exception("invalid tactic, symbol expected", n->get_line(), n->get_pos());
         symbol const & cmd_name = head->get_symbol();
-        if (cmd_name == "and-then" || cmd_name == "then")
-            return mk_and_then(ctx, n);
-        else if (cmd_name == "or-else")
-            return mk_or_else(ctx, n);
-        else if (cmd_name == "par")
-            return mk_par(ctx, n);
-        else if (cmd_name == "par-or")
-            return mk_par(ctx, n);
-        else if (cmd_name == "par-then")
-            return mk_par_then(ctx, n);
-        else if (cmd_name == "try-for")
-            return mk_try_for(ctx, n);
-        else if (cmd_name == "repeat")
-            return mk_repeat(ctx, n);
-        else if (cmd_name == "if" || cmd_name == "ite" || cmd_name == "cond")
-            return mk_if(ctx, n);
-        else if (cmd_name == "fail-if")
-            return mk_fail_if(ctx, n);
-        else if (cmd_name == "fail-if-branching")
-            return mk_fail_if_branching(ctx, n);
-        else if (cmd_name == "when")
-            return mk_when(ctx, n);
-        else if (cmd_name == "!" || cmd_name == "using-params" || cmd_name == "with")
-            return mk_using_params(ctx, n);
-        else if (cmd_name == "echo")
-            return mk_echo(ctx, n);
-        else if (cmd_name == "if-no-proofs")
-            return mk_if_no_proofs(ctx, n);
-        else if (cmd_name == "if-no-models")
-            return mk_if_no_models(ctx, n);
-        else if (cmd_name == "if-no-unsat-cores")
-            return mk_if_no_unsat_cores(ctx, n);
-        else if (cmd_name == "skip-if-failed")
-            return mk_skip_if_failed(ctx, n);
-        else
-            throw cmd_exception("invalid tactic, unknown tactic combinator ", cmd_name, n->get_line(), n->get_pos());
+        return mk_profiled(cmd_name, mk_combinator(ctx, n, cmd_name));
     }
     else {
         throw cmd_exception("invalid tactic, unexpected input", n->get_line(), n->get_pos());
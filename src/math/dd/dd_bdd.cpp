@@ -17,6 +17,8 @@ Revision History:
 
 --*/
 
+#include <functional>
+#include <unordered_map>
 #include "util/trace.h"
 #include "util/stopwatch.h"
 #include "math/dd/dd_bdd.h"
@@ -110,18 +112,19 @@ namespace dd {
 
     bool bdd_manager::check_result(op_entry*& e1, op_entry const* e2, BDD a, BDD b, BDD c) {
         if (e1 != e2) {
-            SASSERT(e2->m_result != null_bdd);
             push_entry(e1);
-            e1 = nullptr;
-            return true;            
-        }
-        else {
-            e1->m_bdd1 = a;
-            e1->m_bdd2 = b;
-            e1->m_op = c;
-            SASSERT(e1->m_result == null_bdd);
-            return false;        
+            if (e2->m_result != null_bdd) {
+                e1 = nullptr;
+                return true;
+            }
+            // the entry of an operation that was interrupted by mem_out is computed again
+            e1 = const_cast<op_entry*>(e2);
         }
+        e1->m_bdd1 = a;
+        e1->m_bdd2 = b;
+        e1->m_op = c;
+        SASSERT(e1->m_result == null_bdd);
+        return false;        
     }
 
     bdd_manager::BDD bdd_manager::apply_rec(BDD a, BDD b, bdd_op op) {
@@ -572,6 +575,25 @@ namespace dd {
         return r;
     }
     
+    bdd bdd_manager::translate(bdd const& b) {
+        if (b.m == this)
+            return bdd(b.root, this);
+        std::unordered_map<BDD, bdd> cache;
+        std::function<bdd(bdd const&)> tr = [&](bdd const& c) -> bdd {
+            if (c.is_true())
+                return mk_true();
+            if (c.is_false())
+                return mk_false();
+            auto it = cache.find(c.root);
+            if (it != cache.end())
+                return it->second;
+            bdd r = mk_ite(mk_var(c.var()), tr(c.hi()), tr(c.lo()));
+            cache.emplace(c.root, r);
+            return r;
+        };
+        return tr(b);
+    }
+
     bdd bdd_manager::mk_ite(bdd const& c, bdd const& t, bdd const& e) {         
         bool first = true;
         scoped_push _sp(*this);
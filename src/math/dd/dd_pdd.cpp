@@ -17,6 +17,8 @@ Revision History:
 
 --*/
 
+#include <functional>
+#include <unordered_map>
 #include "util/trace.h"
 #include "util/stopwatch.h"
 #include "math/dd/dd_pdd.h"
@@ -122,6 +124,22 @@ namespace dd {
         return pdd(apply(p.root, r.root, pdd_subst_val_op), this);
     }
 
+    pdd pdd_manager::translate(pdd const& p) {
+        if (&p.m == this)
+            return p;
+        SASSERT(m_semantics == p.m.m_semantics);
+        std::unordered_map<PDD, pdd> cache;
+        std::function<pdd(pdd const&)> tr = [&](pdd const& q) {
+            auto it = cache.find(q.root);
+            if (it != cache.end())
+                return it->second;
+            pdd r = q.is_val() ? mk_val(q.val()) : tr(q.lo()) + mk_var(q.var()) * tr(q.hi());
+            cache.emplace(q.root, r);
+            return r;
+        };
+        return tr(p);
+    }
+
     pdd_manager::PDD pdd_manager::apply(PDD arg1, PDD arg2, pdd_op op) {
         bool first = true;
         SASSERT(well_formed());
@@ -142,18 +160,19 @@ namespace dd {
 
     bool pdd_manager::check_result(op_entry*& e1, op_entry const* e2, PDD a, PDD b, PDD c) {
         if (e1 != e2) {
-            SASSERT(e2->m_result != null_pdd);
             push_entry(e1);
-            e1 = nullptr;
-            return true;            
-        }
-        else {
-            e1->m_pdd1 = a;
-            e1->m_pdd2 = b;
-            e1->m_op = c;
-            SASSERT(e1->m_result == null_pdd);
-            return false;        
+            if (e2->m_result != null_pdd) {
+                e1 = nullptr;
+                return true;
+            }
+            // the entry of an operation that was interrupted by mem_out is computed again
+            e1 = const_cast<op_entry*>(e2);
         }
+        e1->m_pdd1 = a;
+        e1->m_pdd2 = b;
+        e1->m_op = c;
+        SASSERT(e1->m_result == null_pdd);
+        return false;        
     }
 
     pdd_manager::PDD pdd_manager::apply_rec(PDD p, PDD q, pdd_op op) {        
@@ -134,7 +134,7 @@ namespace dd {
 
         struct eq_entry {
             bool operator()(op_entry * a, op_entry * b) const { 
-                return a->m_pdd1 == b->m_pdd2 && a->m_pdd2 == b->m_pdd2 && a->m_op == b->m_op;
+                return a->m_pdd1 == b->m_pdd1 && a->m_pdd2 == b->m_pdd2 && a->m_op == b->m_op;
             }
         };
 
@@ -279,6 +279,10 @@ namespace dd {
         pdd reduce(pdd const& a, pdd const& b);
         pdd subst_val(pdd const& a, vector<std::pair<unsigned, rational>> const& s);
 
+        // copy of p, which may belong to another manager. That manager must not be in use
+        // by another thread, so each thread can work in its own manager and exchange results.
+        pdd translate(pdd const& p);
+
         bool is_linear(PDD p) { return degree(p) == 1; }
         bool is_linear(pdd const& p);
 
@@ -325,6 +329,7 @@ namespace dd {
         pdd lo() const { return pdd(m.lo(root), m); }
         pdd hi() const { return pdd(m.hi(root), m); }
         unsigned index() const { return root; }
+        pdd_manager& manager() const { return m; }
         unsigned var() const { return m.var(root); }
         rational const& val() const { SASSERT(is_val()); return m.val(root); }
         bool is_val() const { return m.is_val(root); }
@@ -71,17 +71,20 @@ namespace dd {
 
 
     void solver::adjust_cfg() {
-        auto & cfg = m_config;
-        IF_VERBOSE(3, verbose_stream() << "start saturate\n"; display_statistics(verbose_stream()));
-        cfg.m_eqs_threshold = static_cast<unsigned>(cfg.m_eqs_growth * ceil(log(1 + m_to_simplify.size()))* m_to_simplify.size());
-        cfg.m_expr_size_limit = 0;
-        cfg.m_expr_degree_limit = 0;
+        unsigned max_size = 0, max_degree = 0;
         for (equation* e: m_to_simplify) {
-            cfg.m_expr_size_limit = std::max(cfg.m_expr_size_limit, (unsigned)e->poly().tree_size());
-            cfg.m_expr_degree_limit = std::max(cfg.m_expr_degree_limit, e->poly().degree());            
+            max_size = std::max(max_size, (unsigned)e->poly().tree_size());
+            max_degree = std::max(max_degree, e->poly().degree());            
         }
-        cfg.m_expr_size_limit *= cfg.m_expr_size_growth;
-        cfg.m_expr_degree_limit *= cfg.m_expr_degree_growth;;
+        adjust_cfg(m_to_simplify.size(), max_size, max_degree);
+    }
+
+    void solver::adjust_cfg(unsigned num_eqs, unsigned max_size, unsigned max_degree) {
+        auto & cfg = m_config;
+        IF_VERBOSE(3, verbose_stream() << "start saturate\n"; display_statistics(verbose_stream()));
+        cfg.m_eqs_threshold = static_cast<unsigned>(cfg.m_eqs_growth * ceil(log(1 + num_eqs))* num_eqs);
+        cfg.m_expr_size_limit = max_size * cfg.m_expr_size_growth;
+        cfg.m_expr_degree_limit = max_degree * cfg.m_expr_degree_growth;
         
         IF_VERBOSE(3, verbose_stream() << "set m_config.m_eqs_threshold " <<  m_config.m_eqs_threshold  << "\n";
                    verbose_stream() << "set m_config.m_expr_size_limit to " <<  m_config.m_expr_size_limit << "\n";
@@ -362,6 +365,15 @@ namespace dd {
         update_stats_max_degree_and_size(*eq);
     }   
     
+    void solver::reopen_solved() {
+        if (m_conflict)
+            return;
+        equation_vector solved(m_solved);
+        m_solved.reset();
+        for (equation* eq : solved)
+            push_equation(to_simplify, eq);
+    }
+
     bool solver::canceled() {
         return m_limit.is_canceled();
     }
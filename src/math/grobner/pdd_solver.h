@@ -131,13 +131,20 @@ public:
     void set(print_dep_t& pd) { m_print_dep = pd; }
     void set(config const& c) { m_config = c; }
     void adjust_cfg();
+    // sets the limits as for num_eqs input equations of the given maximal size and degree
+    void adjust_cfg(unsigned num_eqs, unsigned max_size, unsigned max_degree);
 
     void reset();
     void add(pdd const& p) { add(p, nullptr); }
     void add(pdd const& p, u_dependency * dep);
+    // returns the solved equations of a saturated basis to the equations to simplify,
+    // so that equations added to the basis are simplified by them
+    void reopen_solved();
 
     void simplify();
     void saturate();
+    // the last saturation reached a fixed point without a conflict
+    bool is_saturated() const { return m_to_simplify.empty() && !m_conflict; }
 
     equation_vector const& equations();
     u_dependency_manager& dep() const { return m_dep_manager;  }
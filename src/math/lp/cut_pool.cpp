@@ -0,0 +1,194 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    cut_pool.cpp
+
+Abstract:
+
+    Pool of the cuts produced by gomory and hnf_cutter
+
+Revision History:
+--*/
+
+#include <algorithm>
+#include "math/lp/int_solver.h"
+#include "math/lp/lar_solver.h"
+#include "math/lp/cut_pool.h"
+
+namespace lp {
+
+    cut_pool::cut_pool(int_solver& lia):lia(lia), lra(lia.lra) {}
+
+    /**
+       Brings sum c <= k to the form where the coefficients are coprime integers,
+       by a positive factor, so parallel cuts get the same left side.
+       The right side is rounded down if all columns are integral.
+    */
+    bool cut_pool::normalize(coeffs& c, mpq& k) const {
+        if (c.empty())
+            return false;
+        std::sort(c.begin(), c.end(), [](std::pair<unsigned, mpq> const& a, std::pair<unsigned, mpq> const& b) {
+                return a.first < b.first; });
+        mpq d(1);
+        for (auto const& p : c)
+            d = lcm(d, denominator(p.second));
+        mpq g(0);
+        for (auto const& p : c)
+            g = gcd(g, abs(p.second * d));
+        mpq f = d / g;
+        bool all_int = true;
+        for (auto& p : c) {
+            p.second *= f;
+            all_int &= lia.column_is_int(p.first);
+        }
+        k *= f;
+        if (all_int)
+            k = floor(k);
+        return true;
+    }
+
+    bool cut_pool::get_premises(vector<premise>& ps) const {
+        for (auto const& ev : *lia.m_ex) {
+            constraint_index ci = ev.ci();
+            if (!lra.constraints().valid_index(ci))
+                return false;
+            auto const& c = lra.constraints()[ci];
+            unsigned j = c.column();
+            switch (c.kind()) {
+            case LE: ps.push_back(premise { j, true, impq(c.rhs()) }); break;
+            case LT: ps.push_back(premise { j, true, impq(c.rhs(), -mpq(1)) }); break;
+            case GE: ps.push_back(premise { j, false, impq(c.rhs()) }); break;
+            case GT: ps.push_back(premise { j, false, impq(c.rhs(), mpq(1)) }); break;
+            case EQ:
+                ps.push_back(premise { j, true, impq(c.rhs()) });
+                ps.push_back(premise { j, false, impq(c.rhs()) });
+                break;
+            default:
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // the current bounds imply the bounds the cut was derived from
+    bool cut_pool::premises_hold(cut const& c) const {
+        for (auto const& p : c.m_premises) {
+            if (p.m_j >= lra.column_count())
+                return false;
+            if (p.m_upper) {
+                if (!lia.has_upper(p.m_j) || lia.upper_bound(p.m_j) > p.m_bound)
+                    return false;
+            }
+            else if (!lia.has_lower(p.m_j) || lia.lower_bound(p.m_j) < p.m_bound)
+                return false;
+        }
+        return true;
+    }
+
+    bool cut_pool::is_violated(cut const& c) const {
+        impq v = zero_of_type<impq>();
+        for (auto const& p : c.m_coeffs)
+            v += p.second * lia.get_value(p.first);
+        return v > impq(c.m_k);
+    }
+
+    // the explanation of a pooled cut consists of the current bound witnesses of its premises
+    void cut_pool::set_cut(cut const& c) {
+        lia.m_t.clear();
+        for (auto const& p : c.m_coeffs)
+            lia.m_t.add_monomial(p.second, p.first);
+        lia.m_k = c.m_k;
+        lia.m_upper = true;
+        lia.m_ex->clear();
+        for (auto const& p : c.m_premises)
+            lia.m_ex->push_back(p.m_upper ? lia.column_upper_bound_constraint(p.m_j) : lia.column_lower_bound_constraint(p.m_j));
+    }
+
+    void cut_pool::remove_cuts(std::function<bool(cut const&)> const& should_remove) {
+        unsigned j = 0;
+        for (unsigned i = 0; i < m_cuts.size(); ++i) {
+            if (should_remove(m_cuts[i])) {
+                m_index.erase(m_cuts[i].m_coeffs);
+                continue;
+            }
+            if (i != j) {
+                m_cuts[j] = m_cuts[i];
+                m_index[m_cuts[j].m_coeffs] = j;
+            }
+            ++j;
+        }
+        m_cuts.shrink(j);
+    }
+
+    void cut_pool::add_cut() {
+        cut c;
+        for (auto const& p : lia.m_t)
+            c.m_coeffs.push_back(std::make_pair(p.column().index(), lia.m_upper ? p.coeff() : -p.coeff()));
+        c.m_k = lia.m_upper ? lia.m_k : -lia.m_k;
+        if (!normalize(c.m_coeffs, c.m_k))
+            return;
+        bool has_premises = get_premises(c.m_premises);
+        auto it = m_index.find(c.m_coeffs);
+        if (it != m_index.end()) {
+            cut& pc = m_cuts[it->second];
+            if (pc.m_k <= c.m_k) {
+                lia.settings().stats().m_cut_pool_dominated++;
+                if (premises_hold(pc)) {
+                    pc.m_age = 0;
+                    set_cut(pc);
+                    lia.settings().stats().m_cut_pool_reused++;
+                    lp_assert(lia.current_solution_is_inf_on_cut());
+                }
+                return;
+            }
+            if (has_premises) {
+                pc.m_k = c.m_k;
+                pc.m_premises = c.m_premises;
+                pc.m_age = 0;
+            }
+            return;
+        }
+        if (!has_premises || m_cuts.size() >= lia.settings().cut_pool_max_size)
+            return;
+        m_index[c.m_coeffs] = m_cuts.size();
+        m_cuts.push_back(c);
+        lia.settings().stats().m_cut_pool_cuts++;
+    }
+
+    lia_move cut_pool::find_violated_cut() {
+        int found = -1;
+        unsigned max_age = lia.settings().cut_pool_max_age;
+        for (unsigned i = 0; i < m_cuts.size(); ++i) {
+            cut& c = m_cuts[i];
+            if (found < 0 && is_violated(c) && premises_hold(c)) {
+                c.m_age = 0;
+                found = i;
+            }
+            else
+                c.m_age++;
+        }
+        if (found >= 0) {
+            set_cut(m_cuts[found]);
+            lia.settings().stats().m_cut_pool_reused++;
+            lp_assert(lia.current_solution_is_inf_on_cut());
+        }
+        unsigned sz = m_cuts.size();
+        remove_cuts([&](cut const& c) { return c.m_age > max_age; });
+        lia.settings().stats().m_cut_pool_aged += sz - m_cuts.size();
+        return found >= 0 ? lia_move::cut : lia_move::undef;
+    }
+
+    void cut_pool::pop_columns(unsigned n) {
+        remove_cuts([&](cut const& c) {
+                for (auto const& p : c.m_coeffs)
+                    if (p.first >= n)
+                        return true;
+                for (auto const& p : c.m_premises)
+                    if (p.m_j >= n)
+                        return true;
+                return false;
+            });
+    }
+}
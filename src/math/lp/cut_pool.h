@@ -0,0 +1,85 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    cut_pool.h
+
+Abstract:
+
+    Pool of the cuts produced by gomory and hnf_cutter
+
+    A cut is kept in the normal form sum a_j x_j <= k where the
+    monomials are sorted by column and the first coefficient is 1
+    or -1, so parallel cuts have equal left sides and only the
+    strongest right side is stored for them. The bounds the cut was
+    derived from are stored as premises: the cut is valid whenever
+    the current bounds of the premise columns are at least as tight,
+    and then the current bound witnesses explain it. This lets a
+    pooled cut be reused after backtracking, or in a later check-sat,
+    as long as its columns exist.
+
+    A cut that is not violated by the current solution ages on
+    every scan, and it is dropped when it reaches the maximal age.
+
+Revision History:
+--*/
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+#include "math/lp/lia_move.h"
+#include "math/lp/lp_settings.h"
+#include "math/lp/numeric_pair.h"
+
+namespace lp {
+    class int_solver;
+    class lar_solver;
+    class cut_pool {
+        typedef vector<std::pair<unsigned, mpq>> coeffs;
+
+        struct premise {
+            unsigned m_j;
+            bool     m_upper;  // x_j <= m_bound if m_upper is true, and x_j >= m_bound otherwise
+            impq     m_bound;
+        };
+
+        struct cut {
+            coeffs          m_coeffs;
+            mpq             m_k;
+            vector<premise> m_premises;
+            unsigned        m_age;
+            cut(): m_age(0) {}
+        };
+
+        struct coeffs_hash {
+            unsigned operator()(coeffs const& c) const {
+                unsigned h = c.size();
+                for (auto const& p : c)
+                    h = combine_hash(h, combine_hash(p.first, p.second.hash()));
+                return h;
+            }
+        };
+
+        class int_solver&  lia;
+        class lar_solver&  lra;
+        vector<cut>        m_cuts;
+        std::unordered_map<coeffs, unsigned, coeffs_hash> m_index;  // the position of a left side in m_cuts
+
+        bool normalize(coeffs& c, mpq& k) const;
+        bool get_premises(vector<premise>& ps) const;
+        bool premises_hold(cut const& c) const;
+        bool is_violated(cut const& c) const;
+        void set_cut(cut const& c);
+        void remove_cuts(std::function<bool(cut const&)> const& should_remove);
+    public:
+        cut_pool(int_solver& lia);
+        // inserts the cut of int_solver, or replaces it by a stronger pooled cut
+        void add_cut();
+        // sets a violated pooled cut as the cut of int_solver
+        lia_move find_violated_cut();
+        // removes the cuts on columns that are popped
+        void pop_columns(unsigned n);
+        unsigned size() const { return m_cuts.size(); }
+    };
+}
@@ -0,0 +1,223 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    float_simplex.cpp
+
+Abstract:
+
+    Feasibility search in doubles over a copy of the rational tableau.
+
+--*/
+
+#include <climits>
+#include <cmath>
+#include "math/lp/float_simplex.h"
+
+namespace lp {
+
+void float_simplex::init(static_matrix<mpq, numeric_pair<mpq>> const& A,
+                         vector<unsigned> const& basis,
+                         vector<column_type> const& column_types,
+                         vector<numeric_pair<mpq>> const& lower_bounds,
+                         vector<numeric_pair<mpq>> const& upper_bounds,
+                         vector<numeric_pair<mpq>> const& x,
+                         double delta) {
+    unsigned m = A.row_count(), n = A.column_count();
+    m_rows.reset();
+    m_rows.resize(m);
+    m_columns.reset();
+    m_columns.resize(n);
+    m_basis.reset();
+    m_heading.reset();
+    m_heading.resize(n, -1);
+    m_x.resize(n);
+    m_lo.resize(n);
+    m_hi.resize(n);
+    m_has_lo.reset();
+    m_has_lo.resize(n, false);
+    m_has_hi.reset();
+    m_has_hi.resize(n, false);
+    m_offset.reset();
+    m_offset.resize(n, -1);
+    m_pivots = 0;
+
+    auto to_double = [&](numeric_pair<mpq> const& v) { return v.x.get_double() + delta * v.y.get_double(); };
+    for (unsigned j = 0; j < n; ++j) {
+        switch (column_types[j]) {
+        case column_type::lower_bound:
+            m_has_lo[j] = true;
+            break;
+        case column_type::upper_bound:
+            m_has_hi[j] = true;
+            break;
+        case column_type::boxed:
+        case column_type::fixed:
+            m_has_lo[j] = m_has_hi[j] = true;
+            break;
+        default:
+            break;
+        }
+        if (m_has_lo[j])
+            m_lo[j] = to_double(lower_bounds[j]);
+        if (m_has_hi[j])
+            m_hi[j] = to_double(upper_bounds[j]);
+        m_x[j] = to_double(x[j]);
+    }
+    // a rational row is sum a_j x_j = 0 with the coefficient 1 at the basic column
+    for (unsigned i = 0; i < m; ++i) {
+        unsigned b = basis[i];
+        m_basis.push_back(b);
+        m_heading[b] = i;
+        for (auto const& c : A.m_rows[i])
+            if (c.var() != b)
+                add_cell(i, c.var(), -c.coeff().get_double());
+    }
+    // recompute the basic values so that they agree with the double rows
+    for (unsigned i = 0; i < m; ++i) {
+        double v = 0;
+        for (cell const& c : m_rows[i])
+            v += c.m_coeff * m_x[c.m_var];
+        m_x[m_basis[i]] = v;
+    }
+}
+
+int float_simplex::find_offset(unsigned i, unsigned j) const {
+    auto const& row = m_rows[i];
+    for (unsigned k = 0; k < row.size(); ++k)
+        if (row[k].m_var == j)
+            return k;
+    return -1;
+}
+
+void float_simplex::add_cell(unsigned i, unsigned j, double c) {
+    m_rows[i].push_back(cell(j, c));
+    m_columns[j].push_back(i);
+}
+
+void float_simplex::remove_row_from_column(unsigned j, unsigned i) {
+    auto& col = m_columns[j];
+    for (unsigned k = 0; k < col.size(); ++k) {
+        if (col[k] == i) {
+            col[k] = col.back();
+            col.pop_back();
+            return;
+        }
+    }
+    UNREACHABLE();
+}
+
+void float_simplex::remove_cell(unsigned i, unsigned offset) {
+    auto& row = m_rows[i];
+    remove_row_from_column(row[offset].m_var, i);
+    row[offset] = row.back();
+    row.pop_back();
+}
+
+/**
+   Solve row i for the entering column and substitute it in the other rows.
+*/
+void float_simplex::pivot(unsigned i, unsigned entering) {
+    unsigned leaving = m_basis[i];
+    auto& row = m_rows[i];
+    int k = find_offset(i, entering);
+    SASSERT(k >= 0);
+    double a = row[k].m_coeff;
+    remove_cell(i, k);
+    for (cell& c : row)
+        c.m_coeff /= -a;
+    add_cell(i, leaving, 1 / a);
+    m_basis[i] = entering;
+    m_heading[entering] = i;
+    m_heading[leaving] = -1;
+
+    unsigned_vector rows(m_columns[entering]);
+    for (unsigned s : rows) {
+        auto& r = m_rows[s];
+        int e = find_offset(s, entering);
+        double d = r[e].m_coeff;
+        remove_cell(s, e);
+        for (unsigned l = 0; l < r.size(); ++l)
+            m_offset[r[l].m_var] = l;
+        for (cell const& c : m_rows[i]) {
+            int o = m_offset[c.m_var];
+            if (o >= 0)
+                r[o].m_coeff += d * c.m_coeff;
+            else {
+                m_offset[c.m_var] = r.size();
+                add_cell(s, c.m_var, d * c.m_coeff);
+            }
+        }
+        for (cell const& c : r)
+            m_offset[c.m_var] = -1;
+        for (unsigned l = r.size(); l-- > 0; )
+            if (std::abs(r[l].m_coeff) < m_settings.drop_tolerance)
+                remove_cell(s, l);
+    }
+    SASSERT(m_columns[entering].empty());
+    ++m_pivots;
+}
+
+/**
+   Move the basic column of row i to v by changing the entering column,
+   and swap the two columns in the basis.
+*/
+void float_simplex::pivot_and_update(unsigned i, unsigned entering, double v) {
+    unsigned b = m_basis[i];
+    double a = m_rows[i][find_offset(i, entering)].m_coeff;
+    double theta = (v - m_x[b]) / a;
+    m_x[b] = v;
+    m_x[entering] += theta;
+    for (unsigned s : m_columns[entering])
+        if (s != i)
+            m_x[m_basis[s]] += m_rows[s][find_offset(s, entering)].m_coeff * theta;
+    pivot(i, entering);
+}
+
+int float_simplex::find_entering(unsigned i, bool increase) const {
+    int result = -1;
+    for (cell const& c : m_rows[i]) {
+        if (std::abs(c.m_coeff) < m_settings.pivot_epsilon)
+            continue;
+        unsigned j = c.m_var;
+        if (result >= 0 && j > static_cast<unsigned>(result))
+            continue;
+        bool up = (c.m_coeff > 0) == increase;
+        if (up ? can_increase(j) : can_decrease(j))
+            result = j;
+    }
+    return result;
+}
+
+float_simplex::status float_simplex::find_feasible_solution(unsigned max_pivots) {
+    while (true) {
+        if (m_settings.get_cancel_flag())
+            return unknown;
+        unsigned leaving = UINT_MAX;
+        for (unsigned b : m_basis)
+            if (b < leaving && (below_lo(b) || above_hi(b)))
+                leaving = b;
+        if (leaving == UINT_MAX)
+            return feasible;
+        if (m_pivots >= max_pivots)
+            return unknown;
+        unsigned i = m_heading[leaving];
+        bool increase = below_lo(leaving);
+        int entering = find_entering(i, increase);
+        if (entering < 0)
+            return infeasible;
+        pivot_and_update(i, entering, increase ? m_lo[leaving] : m_hi[leaving]);
+    }
+}
+
+non_basic_column_value_position float_simplex::get_position(unsigned j) const {
+    SASSERT(!is_basic(j));
+    if (m_has_lo[j] && m_x[j] == m_lo[j])
+        return at_lower_bound;
+    if (m_has_hi[j] && m_x[j] == m_hi[j])
+        return at_upper_bound;
+    return not_at_bound;
+}
+
+}
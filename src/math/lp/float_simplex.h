@@ -0,0 +1,89 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    float_simplex.h
+
+Abstract:
+
+    Feasibility search in doubles over a copy of the rational tableau.
+
+    The rows are kept in the solved form x_b = sum a_j x_j and the search
+    follows the Bland rule: the infeasible basic column with the smallest
+    index leaves, the smallest admissible non-basic column of its row enters.
+    The result is a candidate basis together with the bound positions of the
+    non-basic columns. Nothing computed here is trusted: lar_core_solver moves
+    the rational tableau to the candidate basis and lets the rational simplex
+    verify it, and finish the work if the guess is off.
+
+--*/
+#pragma once
+
+#include "util/vector.h"
+#include "math/lp/lp_settings.h"
+#include "math/lp/static_matrix.h"
+#include "math/lp/numeric_pair.h"
+
+namespace lp {
+
+class float_simplex {
+public:
+    enum status { feasible, infeasible, unknown };
+
+private:
+    struct cell {
+        unsigned m_var;
+        double   m_coeff;
+        cell(unsigned v, double c): m_var(v), m_coeff(c) {}
+    };
+
+    lp_settings&            m_settings;
+    vector<vector<cell>>    m_rows;    // x_{m_basis[i]} = sum of m_rows[i]
+    vector<unsigned_vector> m_columns; // m_columns[j] holds the rows where j occurs
+    unsigned_vector         m_basis;
+    vector<int>             m_heading; // the row of a basic column, -1 for a non-basic column
+    vector<double>          m_x;
+    vector<double>          m_lo;
+    vector<double>          m_hi;
+    bool_vector             m_has_lo;
+    bool_vector             m_has_hi;
+    vector<int>             m_offset;  // work vector, the offset of a column in the row being updated
+    unsigned                m_pivots;
+
+    double tolerance(double v) const {
+        return m_settings.primal_feasibility_tolerance * (1 + (v < 0 ? -v : v));
+    }
+    bool below_lo(unsigned j) const { return m_has_lo[j] && m_x[j] < m_lo[j] - tolerance(m_lo[j]); }
+    bool above_hi(unsigned j) const { return m_has_hi[j] && m_x[j] > m_hi[j] + tolerance(m_hi[j]); }
+    bool can_increase(unsigned j) const { return !m_has_hi[j] || m_x[j] < m_hi[j]; }
+    bool can_decrease(unsigned j) const { return !m_has_lo[j] || m_x[j] > m_lo[j]; }
+
+    int  find_offset(unsigned i, unsigned j) const;
+    void add_cell(unsigned i, unsigned j, double c);
+    void remove_cell(unsigned i, unsigned offset);
+    void remove_row_from_column(unsigned j, unsigned i);
+    void pivot(unsigned i, unsigned entering);
+    void pivot_and_update(unsigned i, unsigned entering, double v);
+    int  find_entering(unsigned i, bool increase) const;
+
+public:
+    float_simplex(lp_settings& s): m_settings(s), m_pivots(0) {}
+
+    void init(static_matrix<mpq, numeric_pair<mpq>> const& A,
+              vector<unsigned> const& basis,
+              vector<column_type> const& column_types,
+              vector<numeric_pair<mpq>> const& lower_bounds,
+              vector<numeric_pair<mpq>> const& upper_bounds,
+              vector<numeric_pair<mpq>> const& x,
+              double delta);
+
+    status find_feasible_solution(unsigned max_pivots);
+
+    vector<int> const& basis_heading() const { return m_heading; }
+    unsigned pivots() const { return m_pivots; }
+    bool is_basic(unsigned j) const { return m_heading[j] >= 0; }
+    non_basic_column_value_position get_position(unsigned j) const;
+};
+
+}
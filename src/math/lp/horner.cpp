@@ -25,6 +25,8 @@
 
 namespace nla {
 typedef intervals::interval interv;
+// the cache is dropped when its expressions reach this number of nodes
+static const unsigned max_cached_nodes = 1 << 16;
 horner::horner(core * c) : common(c), m_row_sum(m_nex_creator) {}
 
 template <typename T>
@@ -73,6 +75,61 @@ bool horner::lemmas_on_expr(cross_nested& cn, nex_sum* e) {
     return cn.done();
 }
 
+static bool same_nex(nex const* a, nex const* b) {
+    if (a->type() != b->type())
+        return false;
+    switch (a->type()) {
+    case expr_type::VAR:
+        return to_var(a)->var() == to_var(b)->var();
+    case expr_type::SCALAR:
+        return to_scalar(a)->value() == to_scalar(b)->value();
+    case expr_type::MUL: {
+        auto const& ma = a->to_mul();
+        auto const& mb = b->to_mul();
+        if (ma.coeff() != mb.coeff() || ma.size() != mb.size())
+            return false;
+        for (unsigned i = 0; i < ma.size(); i++)
+            if (ma[i].pow() != mb[i].pow() || !same_nex(ma[i].e(), mb[i].e()))
+                return false;
+        return true;
+    }
+    case expr_type::SUM: {
+        auto const& sa = a->to_sum();
+        auto const& sb = b->to_sum();
+        if (sa.size() != sb.size())
+            return false;
+        for (unsigned i = 0; i < sa.size(); i++)
+            if (!same_nex(sa[i], sb[i]))
+                return false;
+        return true;
+    }
+    default:
+        UNREACHABLE();
+        return false;
+    }
+}
+
+// The forms of a row depend only on its simplified expression, so when the expression
+// has not changed since the forms were created only their intervals are computed again.
+bool horner::check_cached_forms(nex const* e, u_dependency* dep, bool& ret) {
+    auto it = m_cache.find(m_row_index);
+    if (it == m_cache.end())
+        return false;
+    if (!same_nex(it->second.m_expr, e)) {
+        m_cache.erase(it);
+        return false;
+    }
+    c().lp_settings().stats().m_horner_cache_hits++;
+    for (nex const* f : it->second.m_forms) {
+        if (c().m_intervals.check_nex(f, dep)) {
+            ret = true;
+            return true;
+        }
+    }
+    ret = it->second.m_done;
+    return true;
+}
+
 template <typename T> 
 bool horner::lemmas_on_row(const T& row) {
     SASSERT (row_is_interesting(row));
@@ -86,12 +143,39 @@ bool horner::lemmas_on_row(const T& row) {
         return false;
     if (!e->is_sum())
         return false;
-    
+
+    bool ret = false;
+    bool use_cache = c().m_nla_settings.horner_cache();
+    if (use_cache && check_cached_forms(e, dep, ret)) {
+        m_nex_creator.clear();
+        c().m_intervals.get_dep_intervals().reset();
+        return ret;
+    }
+    if (use_cache && m_cache_creator.size() > max_cached_nodes) {
+        m_cache.clear();
+        m_cache_creator.clear();
+    }
+    row_forms rf;
+    bool found = false;
+    unsigned sz = m_cache_creator.size();
+    if (use_cache)
+        rf.m_expr = m_cache_creator.clone(e);
     cross_nested cn(
-        [this, dep](const nex* n) { return c().m_intervals.check_nex(n, dep); },
+        [&, this](const nex* n) {
+            if (use_cache)
+                rf.m_forms.push_back(m_cache_creator.clone(n));
+            return found = c().m_intervals.check_nex(n, dep);
+        },
         [this](unsigned j)   { return c().var_is_fixed(j); },
         [this]() { return c().random(); }, m_nex_creator);
-    bool ret = lemmas_on_expr(cn, to_sum(e));
+    ret = lemmas_on_expr(cn, to_sum(e));
+    // an exploration stopped by a lemma did not create all forms
+    if (use_cache && !found) {
+        rf.m_done = ret;
+        m_cache[m_row_index] = rf;
+    }
+    else if (use_cache)
+        m_cache_creator.pop(sz);
     c().m_intervals.get_dep_intervals().reset(); // clean the memory allocated by the interval bound dependencies
     return ret;
 
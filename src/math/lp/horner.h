@@ -19,6 +19,7 @@
   --*/
 #pragma once
 
+#include <unordered_map>
 #include "math/lp/nla_common.h"
 #include "math/lp/nla_intervals.h"
 #include "math/lp/nex.h"
@@ -30,8 +31,17 @@ class core;
 
 
 class horner : common {
+    // the cross-nested forms created for a row, re-evaluated while the row does not change
+    struct row_forms {
+        nex*            m_expr;   // the simplified row
+        ptr_vector<nex> m_forms;
+        bool            m_done;   // the result of the exploration
+    };
     nex_creator::sum_factory  m_row_sum;
     unsigned         m_row_index;                      
+    nex_creator      m_cache_creator;                  // owns the cached expressions
+    std::unordered_map<unsigned, row_forms> m_cache;   // from the row index
+    bool check_cached_forms(nex const* e, u_dependency* dep, bool& ret);
 public:
     typedef intervals::interval interv;
     horner(core *core);
@@ -0,0 +1,276 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    int_bb.cpp
+
+Abstract:
+
+    Local branch-and-bound
+
+Revision History:
+--*/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#ifndef SINGLE_THREAD
+#include <thread>
+#endif
+#include "math/lp/int_solver.h"
+#include "math/lp/lar_solver.h"
+#include "math/lp/int_bb.h"
+
+namespace lp {
+
+    // the rows and bounds of the tableau in a form that every worker loads into its own lar_solver
+    struct int_bb::snapshot {
+        vector<column_type>                      m_types;
+        vector<impq>                             m_lower;
+        vector<impq>                             m_upper;
+        bool_vector                              m_is_int;
+        vector<int>                              m_row;   // the row of a basic column, -1 for a non-basic column
+        unsigned_vector                          m_basis;
+        vector<vector<std::pair<mpq, unsigned>>> m_terms; // the basic column of row i equals m_terms[i]
+    };
+
+    struct int_bb::search {
+        snapshot const&         m_snapshot;
+        lp_settings&            m_settings;   // of the caller
+        bool                    m_inline;     // the caller runs the only worker and polls its own limit
+        std::mutex              m_mux;
+        std::condition_variable m_cv;
+        vector<node>            m_open;
+        unsigned                m_active;     // the number of workers expanding a node
+        unsigned                m_running;    // the number of workers that have not returned
+        unsigned                m_nodes;
+        unsigned                m_max_nodes;
+        std::atomic<bool>       m_done;
+        bool                    m_found;
+        vector<impq>            m_solution;
+        search(snapshot const& s, lp_settings& st):
+            m_snapshot(s), m_settings(st), m_inline(true), m_active(0), m_running(0), m_nodes(0),
+            m_max_nodes(st.bb_max_nodes()), m_done(false), m_found(false) {}
+    };
+
+    class int_bb::worker_limit : public lp_resource_limit {
+        search& m_search;
+    public:
+        worker_limit(search& s): m_search(s) {}
+        bool get_cancel_flag() override {
+            return m_search.m_done || (m_search.m_inline && m_search.m_settings.get_cancel_flag());
+        }
+    };
+
+    int_bb::int_bb(int_solver& lia):lia(lia), lra(lia.lra) {}
+
+    lia_move int_bb::operator()() {
+        lia.settings().stats().m_bb_calls++;
+        snapshot s;
+        take_snapshot(s);
+        search srch(s, lia.settings());
+        srch.m_open.push_back(node());
+        unsigned num_threads = lia.settings().bb_threads();
+#ifdef SINGLE_THREAD
+        num_threads = 1;
+#endif
+        if (num_threads <= 1)
+            run_worker(srch);
+#ifndef SINGLE_THREAD
+        else {
+            // the resource limit of the caller is not thread safe, so only this thread polls it
+            srch.m_inline = false;
+            srch.m_running = num_threads;
+            vector<std::thread> threads(num_threads);
+            for (unsigned i = 0; i < num_threads; ++i)
+                threads[i] = std::thread([&]() { run_worker(srch); });
+            {
+                std::unique_lock<std::mutex> lock(srch.m_mux);
+                while (srch.m_running > 0) {
+                    srch.m_cv.wait_for(lock, std::chrono::milliseconds(10));
+                    if (!srch.m_done && lia.settings().get_cancel_flag()) {
+                        srch.m_done = true;
+                        srch.m_cv.notify_all();
+                    }
+                }
+            }
+            for (auto& th : threads)
+                th.join();
+        }
+#endif
+        lia.settings().stats().m_bb_nodes += srch.m_nodes;
+        TRACE("int_bb", tout << "nodes: " << srch.m_nodes << " found: " << srch.m_found << "\n";);
+        if (!srch.m_found || !is_feasible_solution(srch.m_solution))
+            return lia_move::undef;
+        auto& x = lia.lrac.m_r_x;
+        for (unsigned j = 0; j < x.size(); ++j) {
+            x[j] = srch.m_solution[j];
+            lia.lrac.m_r_solver.track_column_feasibility(j);
+        }
+        lp_assert(lra.ax_is_correct());
+        lra.set_status(lp_status::FEASIBLE);
+        lia.settings().stats().m_bb_success++;
+        return lia_move::sat;
+    }
+
+    void int_bb::take_snapshot(snapshot& s) const {
+        unsigned n = lra.column_count();
+        for (unsigned j = 0; j < n; ++j) {
+            s.m_types.push_back(lra.get_column_type(j));
+            s.m_lower.push_back(lra.get_lower_bound(j));
+            s.m_upper.push_back(lra.get_upper_bound(j));
+            s.m_is_int.push_back(lra.column_is_int(j));
+            s.m_row.push_back(lia.lrac.m_r_heading[j] >= 0 ? lia.lrac.m_r_heading[j] : -1);
+        }
+        for (unsigned i = 0; i < lra.A_r().row_count(); ++i) {
+            unsigned b = lra.r_basis()[i];
+            s.m_basis.push_back(b);
+            s.m_terms.push_back(vector<std::pair<mpq, unsigned>>());
+            for (auto const& c : lra.A_r().m_rows[i])
+                if (c.var() != b)
+                    s.m_terms.back().push_back(std::make_pair(-c.coeff(), c.var()));
+        }
+    }
+
+    /**
+       The non-basic columns become variables and the basic columns become terms,
+       so the copy has the rows of the original. vars[j] is the index to bound the
+       copy of column j by, and columns[j] is the column of the copy.
+    */
+    void int_bb::load(snapshot const& s, lar_solver& solver, unsigned_vector& vars, unsigned_vector& columns) {
+        unsigned n = s.m_types.size();
+        vars.resize(n);
+        columns.resize(n);
+        for (unsigned j = 0; j < n; ++j) {
+            if (s.m_row[j] >= 0 && !s.m_terms[s.m_row[j]].empty())
+                continue;
+            vars[j] = solver.add_var(j, s.m_is_int[j]);
+            columns[j] = solver.column_count() - 1;
+            if (s.m_row[j] >= 0)
+                solver.add_var_bound(vars[j], EQ, mpq(0));
+        }
+        for (unsigned i = 0; i < s.m_basis.size(); ++i) {
+            unsigned b = s.m_basis[i];
+            if (s.m_terms[i].empty())
+                continue;
+            vector<std::pair<mpq, var_index>> coeffs;
+            for (auto const& p : s.m_terms[i])
+                coeffs.push_back(std::make_pair(p.first, vars[p.second]));
+            vars[b] = solver.add_term(coeffs, b);
+            columns[b] = solver.column_count() - 1;
+        }
+        for (unsigned j = 0; j < n; ++j) {
+            bool has_lower = false, has_upper = false;
+            switch (s.m_types[j]) {
+            case column_type::lower_bound: has_lower = true; break;
+            case column_type::upper_bound: has_upper = true; break;
+            case column_type::boxed:
+            case column_type::fixed: has_lower = has_upper = true; break;
+            default: break;
+            }
+            if (has_lower)
+                solver.add_var_bound(vars[j], is_pos(s.m_lower[j].y) ? GT : GE, s.m_lower[j].x);
+            if (has_upper)
+                solver.add_var_bound(vars[j], is_neg(s.m_upper[j].y) ? LT : LE, s.m_upper[j].x);
+        }
+    }
+
+    void int_bb::run_worker(search& s) {
+        lar_solver solver;
+        worker_limit lim(s);
+        solver.settings().set_resource_limit(lim);
+        solver.settings().bound_propagation() = false;
+        unsigned_vector vars, columns;
+        load(s.m_snapshot, solver, vars, columns);
+        auto const& is_int = s.m_snapshot.m_is_int;
+        while (true) {
+            node n;
+            {
+                std::unique_lock<std::mutex> lock(s.m_mux);
+                s.m_cv.wait(lock, [&]() { return s.m_done || !s.m_open.empty() || s.m_active == 0; });
+                if (s.m_done || s.m_open.empty() || s.m_nodes >= s.m_max_nodes) {
+                    // the tree is exhausted, or the budget is spent, or a solution is found
+                    s.m_done = true;
+                    s.m_running--;
+                    s.m_cv.notify_all();
+                    return;
+                }
+                n = s.m_open.back();
+                s.m_open.pop_back();
+                s.m_active++;
+                s.m_nodes++;
+            }
+            vector<node> children;
+            solver.push();
+            for (auto const& b : n)
+                solver.add_var_bound(vars[b.m_j], b.m_upper ? LE : GE, b.m_k);
+            lp_status st = solver.find_feasible_solution();
+            if (st == lp_status::FEASIBLE || st == lp_status::OPTIMAL) {
+                int inf = -1;
+                for (unsigned j = 0; j < is_int.size() && inf < 0; ++j)
+                    if (is_int[j] && !solver.get_column_value(columns[j]).is_int())
+                        inf = j;
+                if (inf < 0) {
+                    std::lock_guard<std::mutex> lock(s.m_mux);
+                    if (!s.m_found) {
+                        s.m_found = true;
+                        s.m_done = true;
+                        for (unsigned j = 0; j < columns.size(); ++j)
+                            s.m_solution.push_back(solver.get_column_value(columns[j]));
+                    }
+                }
+                else {
+                    // the lower branch is pushed last to be explored first
+                    mpq k = floor(solver.get_column_value(columns[inf]));
+                    children.push_back(n);
+                    children.back().push_back(bound { static_cast<unsigned>(inf), false, k + 1 });
+                    children.push_back(n);
+                    children.back().push_back(bound { static_cast<unsigned>(inf), true, k });
+                }
+            }
+            solver.pop();
+            std::lock_guard<std::mutex> lock(s.m_mux);
+            for (auto& c : children)
+                s.m_open.push_back(c);
+            s.m_active--;
+            s.m_cv.notify_all();
+        }
+    }
+
+    // the solution of a worker is checked against the rows and bounds of the caller before it is used
+    bool int_bb::is_feasible_solution(vector<impq> const& x) const {
+        if (x.size() != lra.column_count())
+            return false;
+        for (unsigned j = 0; j < x.size(); ++j) {
+            if (lra.column_is_int(j) && !x[j].is_int())
+                return false;
+            switch (lra.get_column_type(j)) {
+            case column_type::fixed:
+            case column_type::boxed:
+                if (x[j] < lra.get_lower_bound(j) || x[j] > lra.get_upper_bound(j))
+                    return false;
+                break;
+            case column_type::lower_bound:
+                if (x[j] < lra.get_lower_bound(j))
+                    return false;
+                break;
+            case column_type::upper_bound:
+                if (x[j] > lra.get_upper_bound(j))
+                    return false;
+                break;
+            default:
+                break;
+            }
+        }
+        for (auto const& row : lra.A_r().m_rows) {
+            impq r = zero_of_type<impq>();
+            for (auto const& c : row)
+                r += c.coeff() * x[c.var()];
+            if (!r.is_zero())
+                return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,54 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    int_bb.h
+
+Abstract:
+
+    Local branch-and-bound
+
+    The current tableau and bounds are copied into one lar_solver per
+    worker thread, and the workers explore a shared branch-and-bound
+    tree over the copies. An integral solution found in the tree
+    satisfies the rows and bounds of the original tableau, so it is
+    copied back and the check returns sat. A tree that is exhausted
+    is not reported: its infeasibility has no explanation in terms
+    of the asserted constraints, and the ordinary branching takes
+    over instead.
+
+Revision History:
+--*/
+#pragma once
+
+#include "math/lp/lia_move.h"
+#include "math/lp/lp_settings.h"
+#include "math/lp/numeric_pair.h"
+
+namespace lp {
+    class int_solver;
+    class lar_solver;
+    class int_bb {
+        struct bound {
+            unsigned m_j; // a column of the original tableau
+            bool     m_upper;
+            mpq      m_k;
+        };
+        typedef vector<bound> node;
+        struct snapshot;
+        struct search;
+        class worker_limit;
+
+        class int_solver& lia;
+        class lar_solver& lra;
+
+        void take_snapshot(snapshot& s) const;
+        static void load(snapshot const& s, lar_solver& solver, unsigned_vector& vars, unsigned_vector& columns);
+        static void run_worker(search& s);
+        bool is_feasible_solution(vector<impq> const& x) const;
+    public:
+        int_bb(int_solver& lia);
+        lia_move operator()();
+    };
+}
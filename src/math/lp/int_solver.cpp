@@ -11,6 +11,7 @@
 #include "math/lp/gomory.h"
 #include "math/lp/int_branch.h"
 #include "math/lp/int_cube.h"
+#include "math/lp/int_bb.h"
 
 namespace lp {
 
@@ -119,7 +120,8 @@ int_solver::int_solver(lar_solver& lar_slv) :
     m_patcher(*this),
     m_number_of_calls(0),
     m_hnf_cutter(*this),
-    m_hnf_cut_period(settings().hnf_cut_period()) {
+    m_hnf_cut_period(settings().hnf_cut_period()),
+    m_cut_pool(*this) {
     lra.set_int_solver(this);
 }
 
@@ -155,8 +157,10 @@ lia_move int_solver::check(lp::explanation * e) {
     ++m_number_of_calls;
     if (r == lia_move::undef && m_patcher.should_apply()) r = m_patcher();
     if (r == lia_move::undef && should_find_cube()) r = int_cube(*this)();
-    if (r == lia_move::undef && should_hnf_cut()) r = hnf_cut();
-    if (r == lia_move::undef && should_gomory_cut()) r = gomory(*this)();
+    if (r == lia_move::undef && should_use_cut_pool()) r = m_cut_pool.find_violated_cut();
+    if (r == lia_move::undef && should_hnf_cut()) r = add_to_cut_pool(hnf_cut());
+    if (r == lia_move::undef && should_gomory_cut()) r = add_to_cut_pool(gomory(*this)());
+    if (r == lia_move::undef && should_run_local_bb()) r = int_bb(*this)();
     if (r == lia_move::undef) r = int_branch(*this)();
     return r;
 }
@@ -267,6 +271,21 @@ bool int_solver::should_gomory_cut() {
     return m_number_of_calls % settings().m_int_gomory_cut_period == 0;
 }
 
+bool int_solver::should_run_local_bb() {
+    return settings().bb_threads() > 0 && m_number_of_calls % settings().bb_period == 0;
+}
+
+// the pool is scanned when a new cut would be generated otherwise
+bool int_solver::should_use_cut_pool() {
+    return settings().cut_pool() && (should_hnf_cut() || should_gomory_cut());
+}
+
+lia_move int_solver::add_to_cut_pool(lia_move r) {
+    if (r == lia_move::cut && settings().cut_pool())
+        m_cut_pool.add_cut();
+    return r;
+}
+
 bool int_solver::should_hnf_cut() {
     return settings().enable_hnf() && m_number_of_calls % m_hnf_cut_period == 0;
 }
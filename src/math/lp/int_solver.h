@@ -27,6 +27,7 @@ Revision History:
 #include "math/lp/int_gcd_test.h"
 #include "math/lp/lia_move.h"
 #include "math/lp/explanation.h"
+#include "math/lp/cut_pool.h"
 
 namespace lp {
 class lar_solver;
@@ -37,6 +38,8 @@ class int_solver {
     friend class gomory;
     friend class int_cube;
     friend class int_branch;
+    friend class int_bb;
+    friend class cut_pool;
     friend class int_gcd_test;
     friend class hnf_cutter;
 
@@ -68,6 +71,7 @@ class int_solver {
     bool                m_upper;           // we have a cut m_t*x <= k if m_upper is true nad m_t*x >= k otherwise
     hnf_cutter          m_hnf_cutter;
     unsigned            m_hnf_cut_period;
+    cut_pool            m_cut_pool;
 
 public:
     int_solver(lar_solver& lp);
@@ -100,6 +104,9 @@ private:
     bool should_find_cube();
     bool should_gomory_cut();
     bool should_hnf_cut();
+    bool should_run_local_bb();
+    bool should_use_cut_pool();
+    lia_move add_to_cut_pool(lia_move r);
 
     lp_settings& settings();
     const lp_settings& settings() const;
@@ -128,5 +135,6 @@ public:
     void find_feasible_solution();
     lia_move hnf_cut();
     void patch_nbasic_column(unsigned j) { m_patcher.patch_nbasic_column(j); }
+    cut_pool& get_cut_pool() { return m_cut_pool; }
   };
 }
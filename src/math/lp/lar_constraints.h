@@ -139,6 +139,7 @@ class constraint_set {
 
 public:
     constraint_set(column_namer& cn): 
+        m_region("lp"),
         m_namer(cn) {}
 
     ~constraint_set() {
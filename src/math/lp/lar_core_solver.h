@@ -18,6 +18,7 @@ Author:
 #include "math/lp/stacked_vector.h"
 #include "math/lp/lar_solution_signature.h"
 #include "util/stacked_value.h"
+#include "math/lp/float_simplex.h"
 namespace lp {
 
 class lar_core_solver  {
@@ -231,6 +232,16 @@ public:
         return settings().simplex_strategy() == simplex_strategy_enum::lu;
     }
 
+    bool need_to_presolve_with_float_simplex() const {
+        return settings().float_first() && settings().use_tableau_rows() &&
+            m_r_solver.m_look_for_feasible_solution_only &&
+            m_r_A.row_count() >= settings().float_first_min_rows;
+    }
+
+    bool pivot_to_basis(vector<int> const& heading);
+
+    void presolve_with_float_simplex();
+
     template <typename L>
     bool is_zero_vector(const vector<L> & b) {
         for (const L & m: b)
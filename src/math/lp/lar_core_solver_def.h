@@ -136,6 +136,80 @@ unsigned lar_core_solver::get_number_of_non_ints() const {
     return n;
 }
 
+/**
+   Pivot the rational tableau towards the basis given by heading: every column
+   of the target basis enters on a row whose basic column is not in the target.
+   Such a row exists as long as the target basis is not singular in rationals;
+   otherwise the method stops and returns false, with the tableau still valid.
+*/
+bool lar_core_solver::pivot_to_basis(vector<int> const& heading) {
+    for (unsigned entering = 0; entering < heading.size(); entering++) {
+        if (heading[entering] < 0 || m_r_heading[entering] >= 0)
+            continue;
+        int row = -1;
+        for (const auto & c : m_r_A.m_columns[entering]) {
+            if (heading[m_r_basis[c.var()]] < 0) {
+                row = c.var();
+                break;
+            }
+        }
+        if (row < 0)
+            return false;
+        unsigned leaving = m_r_basis[row];
+        m_r_solver.change_basis_unconditionally(entering, leaving);
+        if (!m_r_solver.pivot_column_tableau(entering, row)) {
+            m_r_solver.change_basis_unconditionally(leaving, entering);
+            m_r_solver.pivot_column_tableau(leaving, row);
+            return false;
+        }
+    }
+    lp_assert(r_basis_is_OK());
+    return true;
+}
+
+/**
+   Guess a feasible basis with float_simplex and move the rational tableau to it.
+   The non-basic columns are put at the bounds chosen by the float search, and
+   the infeasible ones at the nearest bound. The rational simplex that runs
+   next verifies the guess: it returns at once when the basic values are
+   feasible, and otherwise repairs them with exact pivots.
+*/
+void lar_core_solver::presolve_with_float_simplex() {
+    lp_assert(r_basis_is_OK());
+    ++settings().stats().m_float_first_calls;
+    double delta = find_delta_for_strict_boxed_bounds().get_double();
+    if (delta > 0.000001)
+        delta = 0.000001;
+    float_simplex fs(settings());
+    fs.init(m_r_A, m_r_basis, m_column_types(), m_r_lower_bounds(), m_r_upper_bounds(), m_r_x, delta);
+    unsigned max_pivots = 4 * (m_r_A.row_count() + m_r_A.column_count());
+    auto st = fs.find_feasible_solution(max_pivots);
+    TRACE("lar_solver", tout << "float simplex status " << st << ", pivots " << fs.pivots() << "\n";);
+    if (st == float_simplex::unknown || fs.pivots() == 0)
+        return;
+    pivot_to_basis(fs.basis_heading());
+    for (unsigned j : m_r_nbasis) {
+        non_basic_column_value_position pos = fs.is_basic(j) ? not_at_bound : fs.get_position(j);
+        if (pos == not_at_bound) {
+            if (m_r_solver.column_is_feasible(j))
+                continue;
+            pos = lower_bound_is_set(j) && m_r_x[j] < m_r_lower_bounds()[j] ? at_lower_bound : at_upper_bound;
+        }
+        numeric_pair<mpq> delta_j;
+        if (!update_xj_and_get_delta(j, pos, delta_j))
+            continue;
+        for (const auto & cc : m_r_solver.m_A.m_columns[j]) {
+            unsigned jb = m_r_solver.m_basis[cc.var()];
+            m_r_solver.add_delta_to_x_and_track_feasibility(jb, - delta_j * m_r_solver.m_A.get_val(cc));
+        }
+        m_r_solver.track_column_feasibility(j);
+    }
+    CASSERT("A_off", m_r_solver.A_mult_x_is_off() == false);
+    lp_assert(m_r_solver.inf_set_is_correct());
+    if (m_r_solver.current_x_is_feasible())
+        ++settings().stats().m_float_first_verified;
+}
+
 void lar_core_solver::solve() {
     TRACE("lar_solver", tout << m_r_solver.get_status() << "\n";);
     lp_assert(m_r_solver.non_basic_columns_are_set_correctly());
@@ -165,6 +239,8 @@ void lar_core_solver::solve() {
 
         lp_assert(!settings().use_tableau() || r_basis_is_OK());
     } else {
+        if (need_to_presolve_with_float_simplex())
+            presolve_with_float_simplex();
         if (!settings().use_tableau()) {
             TRACE("lar_solver", tout << "no tablau\n";);
             bool snapped = m_r_solver.snap_non_basic_x_to_bound();   
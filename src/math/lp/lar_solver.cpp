@@ -274,6 +274,8 @@ void lar_solver::pop(unsigned k) {
     remove_non_fixed_from_fixed_var_table();
     clean_popped_elements(n, m_columns_with_changed_bound);
     clean_popped_elements(n, m_incorrect_columns);
+    if (m_int_solver)
+        m_int_solver->get_cut_pool().pop_columns(n);
     
     unsigned m = A_r().row_count();
     clean_popped_elements(m, m_rows_with_changed_bounds);
@@ -732,6 +734,48 @@ void lar_solver::detect_rows_with_changed_bounds() {
         detect_rows_with_changed_bounds_for_column(j);
 }
 
+bool lar_solver::monoid_is_unlimited(const row_cell<mpq> & c, bool from_above) const {
+    switch (get_column_type(c.var())) {
+    case column_type::free_column:
+        return true;
+    case column_type::lower_bound:
+        return is_pos(c.coeff()) == from_above;
+    case column_type::upper_bound:
+        return is_neg(c.coeff()) == from_above;
+    default:
+        return false;
+    }
+}
+
+bool lar_solver::watch_holds(const row_strip<mpq> & row, unsigned offset, bool from_above) const {
+    return offset < row.size() && monoid_is_unlimited(row[offset], from_above);
+}
+
+/**
+   The watches are offsets into the row, so they stay meaningful after the row is
+   changed by a pivot or after a pop: whatever monoid sits at a watched offset is
+   in the row, and only its limits are checked. Bounds get only stronger between
+   pops, so a watch that stops holding is replaced by rescanning the row once.
+*/
+bool lar_solver::row_is_inert_for_bound_propagation(unsigned i) {
+    if (m_row_watches.size() <= i)
+        m_row_watches.resize(A_r().row_count());
+    row_watch & w = m_row_watches[i];
+    const auto & row = A_r().m_rows[i];
+    if (watch_holds(row, w.m_u[0], true) && watch_holds(row, w.m_u[1], true) &&
+        watch_holds(row, w.m_l[0], false) && watch_holds(row, w.m_l[1], false))
+        return true;
+    w = row_watch();
+    unsigned nu = 0, nl = 0;
+    for (unsigned k = 0; k < row.size() && (nu < 2 || nl < 2); k++) {
+        if (nu < 2 && monoid_is_unlimited(row[k], true))
+            w.m_u[nu++] = k;
+        if (nl < 2 && monoid_is_unlimited(row[k], false))
+            w.m_l[nl++] = k;
+    }
+    return nu == 2 && nl == 2;
+}
+
 void lar_solver::update_x_and_inf_costs_for_columns_with_changed_bounds() {
     for (auto j : m_columns_with_changed_bound)
         update_x_and_inf_costs_for_column_with_changed_bounds(j);
@@ -90,6 +90,15 @@ class lar_solver : public column_namer {
     // the set of column indices j such that bounds have changed for j
     u_set                                               m_columns_with_changed_bound;
     u_set                                               m_rows_with_changed_bounds;
+    // A row implies a bound only if it has at most one monoid unlimited from above,
+    // or at most one unlimited from below. m_row_watches[i] keeps the offsets of two monoids
+    // of each kind in row i; while all four stay unlimited the row is not analyzed.
+    struct row_watch {
+        unsigned m_u[2];
+        unsigned m_l[2];
+        row_watch() { m_u[0] = m_u[1] = m_l[0] = m_l[1] = UINT_MAX; }
+    };
+    vector<row_watch>                                   m_row_watches;
     u_set                                               m_basic_columns_with_changed_cost;
     // these are basic columns with the value changed, so the the corresponding row in the tableau
     // does not sum to zero anymore
@@ -176,6 +185,10 @@ class lar_solver : public column_namer {
             || row_has_a_big_num(row_index))
             return;
         lp_assert(use_tableau());
+        if (row_is_inert_for_bound_propagation(row_index)) {
+            settings().stats().m_bprop_inert_rows++;
+            return;
+        }
         
         bound_analyzer_on_row<row_strip<mpq>, lp_bound_propagator<T>>::analyze_row(A_r().m_rows[row_index],
                                                                                    null_ci,
@@ -185,6 +198,9 @@ class lar_solver : public column_namer {
                                                                                    );
     }
 
+    bool monoid_is_unlimited(const row_cell<mpq> & c, bool from_above) const;
+    bool watch_holds(const row_strip<mpq> & row, unsigned offset, bool from_above) const;
+    bool row_is_inert_for_bound_propagation(unsigned i);
     void substitute_basis_var_in_terms_for_row(unsigned i);
     template <typename T>
     void calculate_implied_bounds_for_row(unsigned i, lp_bound_propagator<T> & bp) {
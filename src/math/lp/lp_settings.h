@@ -111,9 +111,21 @@ struct statistics {
     unsigned m_horner_calls;
     unsigned m_horner_conflicts;
     unsigned m_cross_nested_forms;
+    unsigned m_horner_cache_hits;
     unsigned m_grobner_calls;
     unsigned m_grobner_conflicts;
+    unsigned m_grobner_reused;
     unsigned m_cheap_eqs;
+    unsigned m_float_first_calls;
+    unsigned m_float_first_verified;
+    unsigned m_bb_calls;
+    unsigned m_bb_success;
+    unsigned m_bb_nodes;
+    unsigned m_cut_pool_cuts;
+    unsigned m_cut_pool_dominated;
+    unsigned m_cut_pool_reused;
+    unsigned m_cut_pool_aged;
+    unsigned m_bprop_inert_rows;
     statistics() { reset(); }
     void reset() { memset(this, 0, sizeof(*this)); }
 };
@@ -207,11 +219,30 @@ private:
     bool             m_enable_hnf;
     bool             m_print_external_var_name;
     bool             m_cheap_eqs;
+    bool             m_float_first;
+    unsigned         m_bb_threads;
+    unsigned         m_bb_max_nodes;
+    bool             m_cut_pool;
 public:
+    // the float first search is skipped on tableaux with fewer rows
+    unsigned         float_first_min_rows;
+    // the local branch-and-bound runs on every bb_period-th call of int_solver
+    unsigned         bb_period;
+    // a pooled cut is dropped after this many scans without being violated
+    unsigned         cut_pool_max_age;
+    unsigned         cut_pool_max_size;
     bool print_external_var_name() const { return m_print_external_var_name; }
     bool& print_external_var_name() { return m_print_external_var_name; }
     bool cheap_eqs() const { return m_cheap_eqs;}
     bool& cheap_eqs() { return m_cheap_eqs;}
+    bool float_first() const { return m_float_first; }
+    bool& float_first() { return m_float_first; }
+    unsigned bb_threads() const { return m_bb_threads; }
+    unsigned& bb_threads() { return m_bb_threads; }
+    unsigned bb_max_nodes() const { return m_bb_max_nodes; }
+    unsigned& bb_max_nodes() { return m_bb_max_nodes; }
+    bool cut_pool() const { return m_cut_pool; }
+    bool& cut_pool() { return m_cut_pool; }
     unsigned hnf_cut_period() const { return m_hnf_cut_period; }
     void set_hnf_cut_period(unsigned period) { m_hnf_cut_period = period;  }
     unsigned random_next() { return m_rand(); }
@@ -276,7 +307,15 @@ public:
                     limit_on_rows_for_hnf_cutter(75),
                     limit_on_columns_for_hnf_cutter(150),
                     m_enable_hnf(true),
-                    m_print_external_var_name(false)
+                    m_print_external_var_name(false),
+                    m_float_first(false),
+                    m_bb_threads(0),
+                    m_bb_max_nodes(1000),
+                    m_cut_pool(true),
+                    float_first_min_rows(50),
+                    bb_period(16),
+                    cut_pool_max_age(64),
+                    cut_pool_max_size(1000)
                     
     {}
 
@@ -1571,6 +1571,8 @@ void core::run_grobner() {
     lp_settings().stats().m_grobner_calls++;
     configure_grobner();
     m_pdd_grobner.saturate();
+    if (!m_pdd_grobner.is_saturated())
+        m_grobner_input.reset(); // the next call extends only a saturated basis
     bool conflict = false;
     unsigned n = m_pdd_grobner.number_of_conflicts_to_report();
     SASSERT(n > 0);
@@ -1593,17 +1595,45 @@ void core::run_grobner() {
 }
 
 void core::configure_grobner() {
-    m_pdd_grobner.reset();
+    vector<grobner_input> input;
     try {
-        set_level2var_for_grobner();
-        for (unsigned i : m_rows) {
-            add_row_to_grobner(m_lar_solver.A_r().m_rows[i]);
+        // the basis is kept in the variable order it was built with
+        if (!m_grobner_input.empty()) {
+            for (unsigned i : m_rows) {
+                add_row_to_grobner(m_lar_solver.A_r().m_rows[i], input);
+            }
+        }
+        if (!extend_grobner_basis(input)) {
+            input.reset();
+            m_pdd_grobner.reset();
+            m_pdd_grobner.dep().reset();
+            m_grobner_input.reset();
+            set_level2var_for_grobner();
+            for (unsigned i : m_rows) {
+                add_row_to_grobner(m_lar_solver.A_r().m_rows[i], input);
+            }
+            for (auto const& e : input) {
+                m_pdd_grobner.add(e.m_poly, e.m_dep);
+            }
         }
     }
     catch (...) {
         IF_VERBOSE(2, verbose_stream() << "pdd throw\n");
+        m_pdd_grobner.reset();
+        m_grobner_input.reset();
+        for (auto const& e : input)
+            m_pdd_grobner.add(e.m_poly, e.m_dep);
         return;
     }
+    // the limits of an extended basis are those of a basis built from its input
+    unsigned max_size = 0, max_degree = 0;
+    for (auto const& e : input) {
+        max_size = std::max(max_size, (unsigned)e.m_poly.tree_size());
+        max_degree = std::max(max_degree, e.m_poly.degree());
+    }
+    unsigned num_eqs = input.size();
+    if (m_nla_settings.grobner_incremental())
+        m_grobner_input.swap(input);
 #if 0
     IF_VERBOSE(2, m_pdd_grobner.display(verbose_stream()));
     dd::pdd_eval eval(m_pdd_manager);
@@ -1618,17 +1648,53 @@ void core::configure_grobner() {
 #endif
    
     struct dd::solver::config cfg;
-    cfg.m_max_steps = m_pdd_grobner.equations().size();
+    cfg.m_max_steps = num_eqs;
     cfg.m_max_simplified = m_nla_settings.grobner_max_simplified();
     cfg.m_eqs_growth = m_nla_settings.grobner_eqs_growth();
     cfg.m_expr_size_growth = m_nla_settings.grobner_expr_size_growth();
     cfg.m_expr_degree_growth = m_nla_settings.grobner_expr_degree_growth();
     cfg.m_number_of_conflicts_to_report = m_nla_settings.grobner_number_of_conflicts_to_report();
     m_pdd_grobner.set(cfg);
-    m_pdd_grobner.adjust_cfg();
+    m_pdd_grobner.adjust_cfg(num_eqs, max_size, max_degree);
     m_pdd_manager.set_max_num_nodes(10000); // or something proportional to the number of initial nodes.
 }
 
+/**
+   The basis of the previous call is implied by its input equations, so it is kept
+   when each of them is in the new input with the same justification, and only the
+   new equations are added to it.
+*/
+bool core::extend_grobner_basis(vector<grobner_input> const& input) {
+    if (m_grobner_input.empty())
+        return false;
+    std::unordered_map<unsigned, unsigned_vector> poly2input;
+    for (unsigned i = 0; i < input.size(); ++i)
+        poly2input[input[i].m_poly.index()].push_back(i);
+    bool_vector is_old(input.size(), false);
+    for (auto const& e : m_grobner_input) {
+        auto it = poly2input.find(e.m_poly.index());
+        if (it == poly2input.end())
+            return false;
+        bool found = false;
+        for (unsigned i : it->second) {
+            if (!is_old[i] && input[i].m_leaves == e.m_leaves) {
+                is_old[i] = found = true;
+                break;
+            }
+        }
+        if (!found)
+            return false;
+    }
+    m_pdd_grobner.get_stats().reset();
+    m_pdd_grobner.reopen_solved();
+    for (unsigned i = 0; i < input.size(); ++i)
+        if (!is_old[i])
+            m_pdd_grobner.add(input[i].m_poly, input[i].m_dep);
+    lp_settings().stats().m_grobner_reused++;
+    TRACE("grobner", tout << "kept the basis of " << m_grobner_input.size() << " equations, added " << input.size() - m_grobner_input.size() << "\n";);
+    return true;
+}
+
 std::ostream& core::diagnose_pdd_miss(std::ostream& out) {
 
     // m_pdd_grobner.display(out);
@@ -1712,8 +1778,10 @@ void core::add_var_and_its_factors_to_q_and_collect_new_rows(lpvar j, svector<lp
 const rational& core::val_of_fixed_var_with_deps(lpvar j, u_dependency*& dep) {
     unsigned lc, uc;
     m_lar_solver.get_bound_constraint_witnesses_for_column(j, lc, uc);
-    dep = m_intervals.mk_join(dep, m_intervals.mk_leaf(lc));
-    dep = m_intervals.mk_join(dep, m_intervals.mk_leaf(uc));
+    // the dependencies are kept by the grobner solver, as the basis may outlive the interval dependencies
+    auto& dm = m_pdd_grobner.dep();
+    dep = dm.mk_join(dep, dm.mk_leaf(lc));
+    dep = dm.mk_join(dep, dm.mk_leaf(uc));
     return m_lar_solver.column_lower_bound(j).x;
 }
 
@@ -1747,13 +1815,20 @@ dd::pdd core::pdd_expr(const rational& c, lpvar j, u_dependency*& dep) {
     return r;
 }
 
-void core::add_row_to_grobner(const vector<lp::row_cell<rational>> & row) {
+void core::add_row_to_grobner(const vector<lp::row_cell<rational>> & row, vector<grobner_input>& input) {
     u_dependency *dep = nullptr;
     dd::pdd sum = m_pdd_manager.mk_val(rational(0));
     for (const auto &p : row) {
         sum  += pdd_expr(p.coeff(), p.var(), dep);
     }
-    m_pdd_grobner.add(sum, dep);    
+    if (sum.is_zero())
+        return;
+    input.push_back(grobner_input(sum, dep));
+    vector<unsigned, false> leaves;
+    m_pdd_grobner.dep().linearize(dep, leaves);
+    for (unsigned ci : leaves)
+        input.back().m_leaves.push_back(ci);
+    std::sort(input.back().m_leaves.begin(), input.back().m_leaves.end());
 }
 
 
@@ -165,6 +165,13 @@ public:
     nla_settings             m_nla_settings;    
     dd::pdd_manager          m_pdd_manager;
     dd::solver               m_pdd_grobner;
+    struct grobner_input {
+        dd::pdd                  m_poly;
+        u_dependency*            m_dep;
+        unsigned_vector          m_leaves; // the sorted constraint indices of m_dep
+        grobner_input(dd::pdd const& p, u_dependency* d): m_poly(p), m_dep(d) {}
+    };
+    vector<grobner_input>    m_grobner_input; // the equations of the previous grobner call
 private:
     emonics                  m_emons;
     svector<lpvar>           m_add_buffer;
@@ -458,7 +465,8 @@ public:
     void display_matrix_of_m_rows(std::ostream & out) const;
     void set_active_vars_weights(nex_creator&);
     unsigned get_var_weight(lpvar) const;
-    void add_row_to_grobner(const vector<lp::row_cell<rational>> & row);    
+    void add_row_to_grobner(const vector<lp::row_cell<rational>> & row, vector<grobner_input>& input);
+    bool extend_grobner_basis(vector<grobner_input> const& input);
     bool check_pdd_eq(const dd::solver::equation*);
     const rational& val_of_fixed_var_with_deps(lpvar j, u_dependency*& dep);
     dd::pdd pdd_expr(const rational& c, lpvar j, u_dependency*&);
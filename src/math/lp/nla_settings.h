@@ -17,6 +17,7 @@ class nla_settings {
     unsigned m_horner_frequency;
     unsigned m_horner_row_length_limit;
     unsigned m_horner_subs_fixed;
+    bool     m_horner_cache;
     // grobner fields
     bool     m_run_grobner;
     unsigned m_grobner_row_length_limit;
@@ -29,6 +30,7 @@ class nla_settings {
     unsigned m_grobner_number_of_conflicts_to_report;
     unsigned m_grobner_quota;
     unsigned m_grobner_frequency;
+    bool     m_grobner_incremental;
     bool     m_run_nra;
     // expensive patching
     bool     m_expensive_patching;
@@ -39,11 +41,13 @@ public:
                      m_horner_frequency(4),
                      m_horner_row_length_limit(10),
                      m_horner_subs_fixed(2),
+                     m_horner_cache(true),
                      m_run_grobner(true),
                      m_grobner_row_length_limit(50),
                      m_grobner_subs_fixed(false),
                      m_grobner_quota(0),
                      m_grobner_frequency(4),
+                     m_grobner_incremental(true),
                      m_run_nra(false),
                      m_expensive_patching(false)
     {}
@@ -67,11 +71,15 @@ public:
     unsigned& horner_row_length_limit() { return m_horner_row_length_limit; }    
     unsigned horner_subs_fixed() const { return m_horner_subs_fixed; }
     unsigned& horner_subs_fixed() { return m_horner_subs_fixed; }
+    bool horner_cache() const { return m_horner_cache; }
+    bool& horner_cache() { return m_horner_cache; }
 
     bool run_grobner() const { return m_run_grobner; }
     bool& run_grobner() { return m_run_grobner; }
     unsigned grobner_frequency() const { return m_grobner_frequency; }
     unsigned& grobner_frequency() { return m_grobner_frequency; }
+    bool grobner_incremental() const { return m_grobner_incremental; }
+    bool& grobner_incremental() { return m_grobner_incremental; }
 
     bool run_nra() const { return m_run_nra; }
     bool& run_nra() { return m_run_nra; }    
@@ -63,6 +63,9 @@ class static_matrix
 public:
     vector<int> m_vector_of_row_offsets;
     indexed_vector<T> m_work_vector;
+    // buffers of pivot_row_to_row_int
+    vector<int64_t>  m_int_row;
+    vector<unsigned> m_int_new_columns;
     vector<row_strip<T>> m_rows;
     vector<column_strip> m_columns;
     // starting inner classes
@@ -286,6 +289,7 @@ public:
 
     // pivot row i to row ii
     bool pivot_row_to_row_given_cell(unsigned i, column_cell& c, unsigned);
+    bool pivot_row_to_row_int(unsigned i, unsigned ii, T const & alpha, unsigned pivot_col);
     void scan_row_ii_to_offset_vector(const row_strip<T> & rvals);
 
     void transpose_rows(unsigned i, unsigned ii) {
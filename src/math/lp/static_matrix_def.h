@@ -20,6 +20,7 @@ Revision History:
 #include "util/vector.h"
 #include <utility>
 #include <set>
+#include "util/checked_int64.h"
 #include "math/lp/static_matrix.h"
 namespace lp {
 // each assignment for this matrix should be issued only once!!!
@@ -27,6 +28,16 @@ namespace lp {
 inline void addmul(double& r, double a, double b) { r += a*b; }
 inline void addmul(mpq& r, mpq const& a, mpq const& b) { r.addmul(a, b); }
 
+inline bool get_int64(double, int64_t&) { return false; }
+inline bool get_int64(mpq const& a, int64_t& r) {
+    if (!a.is_int64())
+        return false;
+    r = a.get_int64();
+    return true;
+}
+inline void set_int64(double& r, int64_t v) { r = static_cast<double>(v); }
+inline void set_int64(mpq& r, int64_t v) { r = mpq(v, mpq::i64()); }
+
 template <typename T, typename X>
 void  static_matrix<T, X>::init_row_columns(unsigned m, unsigned n) {
     lp_assert(m_rows.size() == 0 && m_columns.size() == 0);
@@ -55,17 +66,19 @@ template <typename T, typename X> bool static_matrix<T, X>::pivot_row_to_row_giv
     scan_row_ii_to_offset_vector(rowii);
     unsigned prev_size_ii = rowii.size();
     // run over the pivot row and update row ii
-    for (const auto & iv : m_rows[i]) {
-        unsigned j = iv.var();
-        if (j == pivot_col) continue;
-        lp_assert(!is_zero(iv.coeff()));
-        int j_offs = m_vector_of_row_offsets[j];
-        if (j_offs == -1) { // it is a new element
-            T alv = alpha * iv.coeff();
-            add_new_element(ii, j, alv);
-        }
-        else {
-            addmul(rowii[j_offs].coeff(), iv.coeff(), alpha);
+    if (!pivot_row_to_row_int(i, ii, alpha, pivot_col)) {
+        for (const auto & iv : m_rows[i]) {
+            unsigned j = iv.var();
+            if (j == pivot_col) continue;
+            lp_assert(!is_zero(iv.coeff()));
+            int j_offs = m_vector_of_row_offsets[j];
+            if (j_offs == -1) { // it is a new element
+                T alv = alpha * iv.coeff();
+                add_new_element(ii, j, alv);
+            }
+            else {
+                addmul(rowii[j_offs].coeff(), iv.coeff(), alpha);
+            }
         }
     }
     // clean the work vector
@@ -82,6 +95,60 @@ template <typename T, typename X> bool static_matrix<T, X>::pivot_row_to_row_giv
 }
 
 
+/*
+  Row ii += alpha * row i in machine integers, for the common case where alpha
+  and the coefficients of both rows are integers that fit in int64.
+  The coefficients of row ii are gathered in the contiguous buffer m_int_row
+  and updated there with checked_int64. Row ii is written back only when no
+  operation overflowed, so on false the caller redoes the update in rationals
+  on the unchanged row. m_vector_of_row_offsets must be set for row ii.
+*/
+template <typename T, typename X> bool static_matrix<T, X>::pivot_row_to_row_int(unsigned i, unsigned ii, T const & alpha, unsigned pivot_col) {
+    typedef checked_int64<true> int64c;
+    int64_t a;
+    if (!get_int64(alpha, a))
+        return false;
+    auto & rowii = m_rows[ii];
+    m_int_row.reset();
+    m_int_new_columns.reset();
+    for (const auto & rc : rowii) {
+        int64_t v;
+        if (!get_int64(rc.coeff(), v))
+            return false;
+        m_int_row.push_back(v);
+    }
+    unsigned sz = m_int_row.size();
+    try {
+        for (const auto & iv : m_rows[i]) {
+            unsigned j = iv.var();
+            if (j == pivot_col) continue;
+            int64_t b;
+            if (!get_int64(iv.coeff(), b))
+                return false;
+            int64c p = int64c(a) * int64c(b);
+            int j_offs = m_vector_of_row_offsets[j];
+            if (j_offs == -1) { // it is a new element
+                m_int_new_columns.push_back(j);
+                m_int_row.push_back(p.get_int64());
+            }
+            else {
+                m_int_row[j_offs] = (int64c(m_int_row[j_offs]) + p).get_int64();
+            }
+        }
+    }
+    catch (int64c::overflow_exception &) {
+        return false;
+    }
+    for (unsigned k = 0; k < sz; k++)
+        set_int64(rowii[k].coeff(), m_int_row[k]);
+    T v;
+    for (unsigned k = 0; k < m_int_new_columns.size(); k++) {
+        set_int64(v, m_int_row[sz + k]);
+        add_new_element(ii, m_int_new_columns[k], v);
+    }
+    return true;
+}
+
 // constructor that copies columns of the basis from A
 template <typename T, typename X>
 static_matrix<T, X>::static_matrix(static_matrix const &A, unsigned * /* basis */) :
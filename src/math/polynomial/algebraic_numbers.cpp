@@ -81,6 +81,11 @@ namespace algebraic_numbers {
         scoped_mpbq_vector       m_isolate_lowers;
         scoped_mpbq_vector       m_isolate_uppers;
         scoped_upoly             m_add_tmp;
+        // the Sturm-Tarski sequence of the last expensive comparison and its polynomials,
+        // since the roots of the same two polynomials are often compared repeatedly
+        scoped_upoly             m_sturm_pa;
+        scoped_upoly             m_sturm_pb;
+        scoped_ptr<upolynomial::scoped_upolynomial_sequence> m_sturm_seq;
         polynomial::var          m_x;
         polynomial::var          m_y;
 
@@ -95,6 +100,7 @@ namespace algebraic_numbers {
         unsigned                 m_compare_sturm;
         unsigned                 m_compare_refine;
         unsigned                 m_compare_poly_eq;
+        unsigned                 m_compare_sturm_reused;
 
         imp(reslimit& lim, manager & w, unsynch_mpq_manager & m, params_ref const & p, small_object_allocator & a):
             m_limit(lim),
@@ -114,7 +120,9 @@ namespace algebraic_numbers {
             m_isolate_roots(bqm()),
             m_isolate_lowers(bqm()),
             m_isolate_uppers(bqm()),
-            m_add_tmp(upm()) {
+            m_add_tmp(upm()),
+            m_sturm_pa(upm()),
+            m_sturm_pb(upm()) {
             updt_params(p);
             reset_statistics();
             m_x = pm().mk_var();
@@ -139,6 +147,7 @@ namespace algebraic_numbers {
             m_compare_sturm   = 0;
             m_compare_refine  = 0;
             m_compare_poly_eq = 0;
+            m_compare_sturm_reused = 0;
         }
 
         void collect_statistics(statistics & st) {
@@ -147,6 +156,7 @@ namespace algebraic_numbers {
             st.update("algebraic compare sturm", m_compare_sturm);
             st.update("algebraic compare refine", m_compare_refine);
             st.update("algebraic compare poly", m_compare_poly_eq);
+            st.update("algebraic compare sturm reused", m_compare_sturm_reused);
 #endif
         }
 
@@ -1758,6 +1768,37 @@ namespace algebraic_numbers {
             return upm().eq(cell_a->m_p_sz, cell_a->m_p, cell_b->m_p_sz, cell_b->m_p);
         }
 
+        upolynomial::upolynomial_sequence const & sturm_tarski_seq(algebraic_cell const * cell_a, algebraic_cell const * cell_b) {
+            if (m_sturm_seq &&
+                upm().eq(cell_a->m_p_sz, cell_a->m_p, m_sturm_pa.size(), m_sturm_pa.c_ptr()) &&
+                upm().eq(cell_b->m_p_sz, cell_b->m_p, m_sturm_pb.size(), m_sturm_pb.c_ptr())) {
+                m_compare_sturm_reused++;
+                return *m_sturm_seq;
+            }
+            // the sequence is stored only when it is complete
+            m_sturm_seq = nullptr;
+            scoped_ptr<upolynomial::scoped_upolynomial_sequence> seq = alloc(upolynomial::scoped_upolynomial_sequence, upm());
+            upm().sturm_tarski_seq(cell_a->m_p_sz, cell_a->m_p, cell_b->m_p_sz, cell_b->m_p, *seq);
+            upm().set(cell_a->m_p_sz, cell_a->m_p, m_sturm_pa);
+            upm().set(cell_b->m_p_sz, cell_b->m_p, m_sturm_pb);
+            m_sturm_seq = seq.detach();
+            return *m_sturm_seq;
+        }
+
+        /**
+           \brief a and b are equal roots with different polynomials.
+           The one with the larger polynomial becomes a copy of the other,
+           so comparing them again takes the cheap polynomial equality path.
+        */
+        void share_root(numeral & a, numeral & b) {
+            algebraic_cell * cell_a = a.to_algebraic();
+            algebraic_cell * cell_b = b.to_algebraic();
+            if (cell_a->m_p_sz < cell_b->m_p_sz)
+                std::swap(cell_a, cell_b);
+            del_poly(cell_a);
+            copy(cell_a, cell_b);
+        }
+
         ::sign compare_core(numeral & a, numeral & b) {
             SASSERT(!a.is_basic() && !b.is_basic());
             algebraic_cell * cell_a = a.to_algebraic();
@@ -1865,8 +1906,7 @@ namespace algebraic_numbers {
            //
 
            m_compare_sturm++;
-           upolynomial::scoped_upolynomial_sequence seq(upm());
-           upm().sturm_tarski_seq(cell_a->m_p_sz, cell_a->m_p, cell_b->m_p_sz, cell_b->m_p, seq);
+           upolynomial::upolynomial_sequence const & seq = sturm_tarski_seq(cell_a, cell_b);
            unsigned V1 = upm().sign_variations_at(seq, a_lower);
            unsigned V2 = upm().sign_variations_at(seq, a_upper); 
            int V =  V1 - V2;
@@ -1878,8 +1918,10 @@ namespace algebraic_numbers {
                  << ", sign_lower(b): " << sign_lower(cell_b) << "\n";
                  /*upm().display(tout << "sequence: ", seq);*/
                  );
-           if (V == 0)
+           if (V == 0) {
+               share_root(a, b);
                return sign_zero;
+           }
            if ((V < 0) == (sign_lower(cell_b) < 0))
                return sign_neg;
            else
@@ -93,8 +93,19 @@ namespace polynomial {
         polynomial_ref_vector    m_cached_polys;
         svector<char>            m_in_cache;
         small_object_allocator & m_allocator;
+        unsigned                 m_max_entries;
 
-        imp(manager & _m):m(_m), m_poly_table(poly_hash_proc(m), poly_eq_proc(m)), m_cached_polys(m), m_allocator(m.allocator()) {
+        struct stats {
+            unsigned m_psc_chain_hits;
+            unsigned m_psc_chain_misses;
+            unsigned m_factor_hits;
+            unsigned m_factor_misses;
+            unsigned m_flushes;
+            stats() { memset(this, 0, sizeof(*this)); }
+        };
+        stats                    m_stats;
+
+        imp(manager & _m):m(_m), m_poly_table(poly_hash_proc(m), poly_eq_proc(m)), m_cached_polys(m), m_allocator(m.allocator()), m_max_entries(0) {
         }
         
         ~imp() {
@@ -135,6 +146,15 @@ namespace polynomial {
         }
 
         unsigned pid(polynomial * p) const { return m.id(p); }
+
+        // the results refer to unique polynomials, so dropping them keeps the polynomials alive
+        void check_max_entries() {
+            if (m_max_entries == 0 || m_psc_chain_cache.size() + m_factor_cache.size() < m_max_entries)
+                return;
+            reset_psc_chain_cache();
+            reset_factor_cache();
+            m_stats.m_flushes++;
+        }
         
         polynomial * mk_unique(polynomial * p) {
             if (m_in_cache.get(pid(p), false))
@@ -148,59 +168,64 @@ namespace polynomial {
             return p_prime;
         }
 
+        // The entry is inserted after its result is computed, so an interrupted
+        // computation does not leave an entry without a result.
         void psc_chain(polynomial * p, polynomial * q, var x, polynomial_ref_vector & S) {
             p = mk_unique(p);
             q = mk_unique(q);
-            unsigned h = hash_u_u(pid(p), pid(q));
-            psc_chain_entry * entry = new (m_allocator.allocate(sizeof(psc_chain_entry))) psc_chain_entry(p, q, x, h);
-            psc_chain_entry * old_entry = m_psc_chain_cache.insert_if_not_there(entry); 
-            if (entry != old_entry) {
-                entry->~psc_chain_entry();
-                m_allocator.deallocate(sizeof(psc_chain_entry), entry);
+            unsigned h = combine_hash(hash_u_u(pid(p), pid(q)), x);
+            psc_chain_entry key(p, q, x, h);
+            psc_chain_entry * old_entry = nullptr;
+            if (m_psc_chain_cache.find(&key, old_entry)) {
+                m_stats.m_psc_chain_hits++;
                 S.reset();
                 for (unsigned i = 0; i < old_entry->m_result_sz; i++) {
                     S.push_back(old_entry->m_result[i]);
                 }
+                return;
             }
-            else {
-                m.psc_chain(p, q, x, S);
-                unsigned sz = S.size();
-                entry->m_result_sz = sz;
-                entry->m_result    = static_cast<polynomial**>(m_allocator.allocate(sizeof(polynomial*)*sz));
-                for (unsigned i = 0; i < sz; i++) {
-                    polynomial * h = mk_unique(S.get(i));
-                    S.set(i, h);
-                    entry->m_result[i] = h;
-                }
+            m_stats.m_psc_chain_misses++;
+            m.psc_chain(p, q, x, S);
+            check_max_entries();
+            psc_chain_entry * entry = new (m_allocator.allocate(sizeof(psc_chain_entry))) psc_chain_entry(p, q, x, h);
+            unsigned sz = S.size();
+            entry->m_result_sz = sz;
+            entry->m_result    = static_cast<polynomial**>(m_allocator.allocate(sizeof(polynomial*)*sz));
+            for (unsigned i = 0; i < sz; i++) {
+                polynomial * h = mk_unique(S.get(i));
+                S.set(i, h);
+                entry->m_result[i] = h;
             }
+            m_psc_chain_cache.insert(entry);
         }
 
         void factor(polynomial * p, polynomial_ref_vector & distinct_factors) {
             distinct_factors.reset();
             p = mk_unique(p);
             unsigned h = hash_u(pid(p));
-            factor_entry * entry = new (m_allocator.allocate(sizeof(factor_entry))) factor_entry(p, h);
-            factor_entry * old_entry = m_factor_cache.insert_if_not_there(entry); 
-            if (entry != old_entry) {
-                entry->~factor_entry();
-                m_allocator.deallocate(sizeof(factor_entry), entry);
-                distinct_factors.reset();
+            factor_entry key(p, h);
+            factor_entry * old_entry = nullptr;
+            if (m_factor_cache.find(&key, old_entry)) {
+                m_stats.m_factor_hits++;
                 for (unsigned i = 0; i < old_entry->m_result_sz; i++) {
                     distinct_factors.push_back(old_entry->m_result[i]);
                 }
+                return;
             }
-            else {
-                factors fs(m);
-                m.factor(p, fs);
-                unsigned sz = fs.distinct_factors();
-                entry->m_result_sz = sz;
-                entry->m_result    = static_cast<polynomial**>(m_allocator.allocate(sizeof(polynomial*)*sz));
-                for (unsigned i = 0; i < sz; i++) {
-                    polynomial * h = mk_unique(fs[i]);
-                    distinct_factors.push_back(h);
-                    entry->m_result[i] = h;
-                }
+            m_stats.m_factor_misses++;
+            factors fs(m);
+            m.factor(p, fs);
+            check_max_entries();
+            factor_entry * entry = new (m_allocator.allocate(sizeof(factor_entry))) factor_entry(p, h);
+            unsigned sz = fs.distinct_factors();
+            entry->m_result_sz = sz;
+            entry->m_result    = static_cast<polynomial**>(m_allocator.allocate(sizeof(polynomial*)*sz));
+            for (unsigned i = 0; i < sz; i++) {
+                polynomial * h = mk_unique(fs[i]);
+                distinct_factors.push_back(h);
+                entry->m_result[i] = h;
             }
+            m_factor_cache.insert(entry);
         }
     };
 
@@ -230,7 +255,23 @@ namespace polynomial {
     
     void cache::reset() {
         manager & _m = m();
+        unsigned max_entries = m_imp->m_max_entries;
+        imp::stats st = m_imp->m_stats;
         dealloc(m_imp);
         m_imp = alloc(imp, _m);
+        m_imp->m_max_entries = max_entries;
+        m_imp->m_stats = st;
+    }
+
+    void cache::set_max_entries(unsigned n) {
+        m_imp->m_max_entries = n;
+    }
+
+    void cache::collect_statistics(statistics & st) const {
+        st.update("psc chain cache hits", m_imp->m_stats.m_psc_chain_hits);
+        st.update("psc chain cache misses", m_imp->m_stats.m_psc_chain_misses);
+        st.update("factor cache hits", m_imp->m_stats.m_factor_hits);
+        st.update("factor cache misses", m_imp->m_stats.m_factor_misses);
+        st.update("polynomial cache flushes", m_imp->m_stats.m_flushes);
     }
 };
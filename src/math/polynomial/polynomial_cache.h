@@ -18,6 +18,7 @@ Notes:
 --*/
 #pragma once
 
+#include "util/statistics.h"
 #include "math/polynomial/polynomial.h"
 
 namespace polynomial {
@@ -37,6 +38,12 @@ namespace polynomial {
         void psc_chain(polynomial const * p, polynomial const * q, var x, polynomial_ref_vector & S);
         void factor(polynomial const * p, polynomial_ref_vector & distinct_factors);
         void reset();
+        /**
+           \brief The psc chain and factorization results are dropped when their number reaches n.
+           The unique polynomials are kept. n == 0 means no limit.
+        */
+        void set_max_entries(unsigned n);
+        void collect_statistics(statistics & st) const;
     };
 };
 
@@ -229,10 +229,15 @@ namespace nlsat {
            \brief Wrapper for psc chain computation
         */
         void psc_chain(polynomial_ref & p, polynomial_ref & q, unsigned x, polynomial_ref_vector & result) {
-            // TODO caching
             SASSERT(max_var(p) == max_var(q));
             SASSERT(max_var(p) == x);
-            m_cache.psc_chain(p, q, x, result);
+            // The subresultants of q and p are equal to the ones of p and q up to sign
+            // when the degrees are equal, so one cache entry serves both orders.
+            poly * up = m_cache.mk_unique(p);
+            poly * uq = m_cache.mk_unique(q);
+            if (m_pm.id(uq) < m_pm.id(up) && degree(p, x) == degree(q, x))
+                std::swap(up, uq);
+            m_cache.psc_chain(up, uq, x, result);
         }
         
         /**
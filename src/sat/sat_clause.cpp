@@ -157,7 +157,7 @@ namespace sat {
     }
 
     clause_allocator::clause_allocator():
-        m_allocator("clause-allocator") {
+        m_allocator("sat") {
     }
 
     void clause_allocator::finalize() {
@@ -50,6 +50,7 @@ static char const * g_input_file          = nullptr;
 static bool         g_standard_input      = false;
 static input_kind   g_input_kind          = IN_UNSPECIFIED;
 bool                g_display_statistics  = false;
+bool                g_display_statistics_json = false;
 static bool         g_display_istatistics = false;
 
 static void error(const char * msg) {
@@ -102,6 +103,7 @@ void display_usage() {
     // 
     std::cout << "\nOutput:\n";
     std::cout << "  -st         display statistics.\n";
+    std::cout << "  -st:json    display statistics, including the time and memory of solver phases, in JSON format.\n";
 #if defined(Z3DEBUG) || defined(_TRACE)
     std::cout << "\nDebugging support:\n";
 #endif
@@ -205,6 +207,13 @@ static void parse_cmd_line_args(int argc, char ** argv) {
             else if (strcmp(opt_name, "st") == 0) {
                 g_display_statistics = true; 
                 gparams::set("stats", "true");
+                if (opt_arg && strcmp(opt_arg, "json") == 0) {
+                    g_display_statistics_json = true;
+                    gparams::set("phase_profile", "true");
+                }
+                else if (opt_arg) {
+                    error("invalid argument for option -st, only -st:json is supported.");
+                }
             }
             else if (strcmp(opt_name, "ist") == 0) {
                 g_display_istatistics = true; 
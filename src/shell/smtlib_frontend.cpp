@@ -35,6 +35,7 @@ Revision History:
 static mutex *display_stats_mux = new mutex;
 
 extern bool g_display_statistics;
+extern bool g_display_statistics_json;
 static clock_t             g_start_time;
 static cmd_context *       g_cmd_context = nullptr;
 
@@ -46,7 +47,7 @@ static void display_statistics() {
         std::cerr.flush();
         if (g_cmd_context) {
             g_cmd_context->set_regular_stream("stdout");
-            g_cmd_context->display_statistics(true, ((static_cast<double>(end_time) - static_cast<double>(g_start_time)) / CLOCKS_PER_SEC));
+            g_cmd_context->display_statistics(true, ((static_cast<double>(end_time) - static_cast<double>(g_start_time)) / CLOCKS_PER_SEC), g_display_statistics_json);
         }
     }
 }
@@ -17,6 +17,7 @@ Revision History:
 
 --*/
 #include "util/warning.h"
+#include "util/phase_profiler.h"
 #include "ast/ast_ll_pp.h"
 #include "ast/ast_pp.h"
 #include "ast/for_each_expr.h"
@@ -247,6 +248,7 @@ void asserted_formulas::reduce() {
         return;
     if (!m_has_quantifiers && !m_smt_params.m_preprocess)
         return;
+    scoped_phase _phase("preprocess");
     if (m_macro_manager.has_macros())
         invoke(m_find_macros);
 
@@ -236,6 +236,8 @@ struct smt_params : public preprocessor_params,
     // -----------------------------------
     symbol m_string_solver;
 
+    bool   m_fp_lazy;
+
     smt_params(params_ref const & p = params_ref()):
         m_display_proof(false),
         m_display_dot_proof(false),
@@ -306,7 +308,8 @@ struct smt_params : public preprocessor_params,
         m_check_at_labels(false),
         m_dump_goal_as_smt(false),
         m_auto_config(true),
-        m_string_solver(symbol("auto")){
+        m_string_solver(symbol("auto")),
+        m_fp_lazy(false) {
         updt_local_params(p);
     }
 
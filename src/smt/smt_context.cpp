@@ -20,6 +20,7 @@ Revision History:
 #include "util/luby.h"
 #include "util/warning.h"
 #include "util/timeit.h"
+#include "util/phase_profiler.h"
 #include "util/union_find.h"
 #include "ast/ast_pp.h"
 #include "ast/ast_ll_pp.h"
@@ -59,6 +60,7 @@ namespace smt {
         m_progress_callback(nullptr),
         m_next_progress_sample(0),
         m_clause_proof(*this),
+        m_region("smt"),
         m_fingerprints(m, m_region),
         m_b_internalized_stack(m),
         m_e_internalized_stack(m),
@@ -3432,6 +3434,7 @@ namespace smt {
     */
     lbool context::setup_and_check(bool reset_cancel) {
         if (!check_preamble(reset_cancel)) return l_undef;
+        scoped_phase _phase("smt");
         SASSERT(m_scope_lvl == 0);
         SASSERT(!m_setup.already_configured());
         setup_context(m_fparams.m_auto_config);
@@ -3498,6 +3501,7 @@ namespace smt {
         // IF_VERBOSE(15, m_asserted_formulas.display(verbose_stream()););
         // IF_VERBOSE(15, verbose_stream() << "\n";);
         if (!check_preamble(reset_cancel)) return l_undef;
+        scoped_phase _phase("smt");
         SASSERT(at_base_level());
         setup_context(false);
         if (m_fparams.m_threads > 1 && !m.has_trace_stream()) {            
@@ -3527,6 +3531,7 @@ namespace smt {
 
     lbool context::check(expr_ref_vector const& cube, vector<expr_ref_vector> const& clauses) {
         if (!check_preamble(true)) return l_undef;
+        scoped_phase _phase("smt");
         TRACE("before_search", display(tout););
         setup_context(false);
         lbool r;
@@ -3619,6 +3624,7 @@ namespace smt {
         if (get_cancel_flag())
             return l_undef;
         timeit tt(get_verbosity_level() >= 100, "smt.stats");
+        scoped_phase _phase("search");
         reset_model();
         SASSERT(at_search_level());
         TRACE("search", display(tout); display_enodes_lbls(tout););
@@ -779,6 +779,269 @@ namespace smt {
     MK_AC_BINARY(internalize_xnor,     mk_xnor);
     MK_BINARY(internalize_comp,     mk_comp);
 
+    /**
+       \brief Number of low bits of a delayed multiplier that are bit-blasted eagerly,
+       and number of value lemmas a delayed term receives before its full circuit is asserted.
+    */
+    static const unsigned s_delay_low_bits   = 8;
+    static const unsigned s_delay_max_lemmas = 8;
+
+    bool theory_bv::should_delay(app * n) const {
+        return 
+            params().m_bv_delay &&
+            n->get_num_args() == 2 &&
+            get_bv_size(n) > s_delay_low_bits &&
+            !m_util.is_numeral(n->get_arg(0)) &&
+            !m_util.is_numeral(n->get_arg(1));
+    }
+
+    /**
+       \brief Internalize a multiplier or divider with fresh bits. Only the low bits
+       of a product are defined eagerly, since they depend only on the low bits of the arguments.
+       The remaining bits are constrained by check_delayed_ops.
+    */
+    void theory_bv::internalize_delayed(app * n) {
+        SASSERT(!ctx.e_internalized(n));
+        SASSERT(n->get_num_args() == 2);
+        process_args(n);
+        enode * e       = mk_enode(n);
+        theory_var v    = e->get_th_var(get_id());
+        mk_bits(v);
+        if (m_util.is_bv_mul(n)) {
+            expr_ref_vector arg1_bits(m), arg2_bits(m), bits(m);
+            get_arg_bits(e, 0, arg1_bits);
+            get_arg_bits(e, 1, arg2_bits);
+            m_bb.mk_multiplier(s_delay_low_bits, arg1_bits.c_ptr(), arg2_bits.c_ptr(), bits);
+            assert_bits_eq(v, bits);
+        }
+        m_delayed_ops.push_back(delayed_op(n));
+        m_trail_stack.push(push_back_vector<theory_bv, svector<delayed_op>>(m_delayed_ops));
+        TRACE("bv", tout << "delayed: " << mk_bounded_pp(n, m) << "\n";);
+    }
+
+    /**
+       \brief Assert that the first bits.size() bits of v are equivalent to bits.
+    */
+    void theory_bv::assert_bits_eq(theory_var v, expr_ref_vector const & bits) {
+        ctx.internalize(bits.c_ptr(), bits.size(), true);
+        for (unsigned i = 0; i < bits.size(); ++i) {
+            literal l = ctx.get_literal(bits.get(i));
+            literal b = m_bits[v][i];
+            if (l == b)
+                continue;
+            ctx.mark_as_relevant(l);
+            ctx.mk_th_axiom(get_id(), ~b,  l);
+            ctx.mk_th_axiom(get_id(),  b, ~l);
+        }
+    }
+
+    void theory_bv::eval_delayed(app * n, numeral const & a, numeral const & b, numeral & r) const {
+        numeral N = m_bb.power(get_bv_size(n));
+        if (m_util.is_bv_mul(n))
+            r = mod(a * b, N);
+        else if (m_util.is_bv_udivi(n))
+            r = b.is_zero() ? N - numeral(1) : div(a, b);
+        else {
+            SASSERT(m_util.is_bv_uremi(n));
+            r = b.is_zero() ? a : mod(a, b);
+        }
+    }
+
+    /**
+       \brief Add to lits the literals that are false when v has value val.
+    */
+    void theory_bv::push_value_literals(theory_var v, numeral val, literal_vector & lits) const {
+        numeral two(2);
+        for (literal b : m_bits[v]) {
+            lits.push_back(val.is_even() ? b : ~b);
+            val = div(val, two);
+        }
+    }
+
+    void theory_bv::blast_delayed(unsigned idx) {
+        app * n = m_delayed_ops[idx].m_term;
+        TRACE("bv", tout << "blast delayed: " << mk_bounded_pp(n, m) << "\n";);
+        m_trail_stack.push(vector_value_trail<theory_bv, delayed_op, false>(m_delayed_ops, idx));
+        m_delayed_ops[idx].m_blasted = true;
+        m_stats.m_num_delay_blasts++;
+        enode * e = ctx.get_enode(n);
+        expr_ref_vector arg1_bits(m), arg2_bits(m), bits(m);
+        get_arg_bits(e, 0, arg1_bits);
+        get_arg_bits(e, 1, arg2_bits);
+        unsigned sz = arg1_bits.size();
+        if (m_util.is_bv_mul(n))
+            m_bb.mk_multiplier(sz, arg1_bits.c_ptr(), arg2_bits.c_ptr(), bits);
+        else if (m_util.is_bv_udivi(n))
+            m_bb.mk_udiv(sz, arg1_bits.c_ptr(), arg2_bits.c_ptr(), bits);
+        else
+            m_bb.mk_urem(sz, arg1_bits.c_ptr(), arg2_bits.c_ptr(), bits);
+        assert_bits_eq(e->get_th_var(get_id()), bits);
+    }
+
+    /**
+       \brief Check the delayed terms against the current assignment.
+       A violated term receives the lemma (arg1 = a & arg2 = b) => n = op(a, b),
+       restricted to the bits that disagree, or its full circuit once it
+       has received s_delay_max_lemmas lemmas.
+       Return false if some term was refined.
+    */
+    bool theory_bv::check_delayed_ops() {
+        bool ok = true;
+        for (unsigned i = 0; i < m_delayed_ops.size(); ++i) {
+            if (m_delayed_ops[i].m_blasted)
+                continue;
+            app * n = m_delayed_ops[i].m_term;
+            if (!ctx.is_relevant(n))
+                continue;
+            enode * e     = ctx.get_enode(n);
+            theory_var v  = e->get_th_var(get_id());
+            theory_var v1 = get_arg_var(e, 0);
+            theory_var v2 = get_arg_var(e, 1);
+            numeral a, b, r, val;
+            if (!get_fixed_value(v1, a) || !get_fixed_value(v2, b) || !get_fixed_value(v, r)) {
+                blast_delayed(i);
+                ok = false;
+                continue;
+            }
+            eval_delayed(n, a, b, val);
+            if (r == val)
+                continue;
+            ok = false;
+            if (m_delayed_ops[i].m_num_lemmas >= s_delay_max_lemmas) {
+                blast_delayed(i);
+                continue;
+            }
+            m_delayed_ops[i].m_num_lemmas++;
+            m_stats.m_num_delay_lemmas++;
+            TRACE("bv", tout << "delayed lemma: " << mk_bounded_pp(n, m) << " " << a << " " << b << " " << r << " != " << val << "\n";);
+            m_tmp_literals.reset();
+            push_value_literals(v1, a, m_tmp_literals);
+            push_value_literals(v2, b, m_tmp_literals);
+            numeral two(2);
+            for (literal bit : m_bits[v]) {
+                bool is_true = !val.is_even();
+                if (is_true == r.is_even()) {
+                    m_tmp_literals.push_back(is_true ? bit : ~bit);
+                    ctx.mk_th_axiom(get_id(), m_tmp_literals.size(), m_tmp_literals.c_ptr());
+                    m_tmp_literals.pop_back();
+                }
+                val = div(val, two);
+                r   = div(r, two);
+            }
+        }
+        return ok;
+    }
+
+    /**
+       \brief Return the number of consecutive bits of v, starting at the most significant bit
+       if from_top and at the least significant bit otherwise, that are assigned to false.
+       The literals justifying them are added to expl.
+    */
+    unsigned theory_bv::fixed_zeros(theory_var v, bool from_top, literal_vector & expl) const {
+        literal_vector const & bits = m_bits[v];
+        unsigned sz = bits.size();
+        unsigned r  = 0;
+        for (; r < sz; ++r) {
+            literal b = bits[from_top ? sz - r - 1 : r];
+            if (ctx.get_assignment(b) != l_false)
+                break;
+            if (b != false_literal)
+                expl.push_back(~b);
+        }
+        return r;
+    }
+
+    bool theory_bv::find_true_bit(theory_var v, literal & l) const {
+        for (literal b : m_bits[v]) {
+            if (ctx.get_assignment(b) == l_true) {
+                l = b;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+       \brief Assign the bits [lo, hi) of v to is_true, justified by expl.
+    */
+    void theory_bv::propagate_word_bits(theory_var v, unsigned lo, unsigned hi, bool is_true, literal_vector const & expl) {
+        for (unsigned i = lo; i < hi && !ctx.inconsistent(); ++i) {
+            literal c = is_true ? m_bits[v][i] : ~m_bits[v][i];
+            if (ctx.get_assignment(c) == l_true)
+                continue;
+            m_stats.m_num_word_props++;
+            ctx.assign(c, ctx.mk_justification(ext_theory_propagation_justification(get_id(), ctx.get_region(), expl.size(), expl.c_ptr(), 0, nullptr, c)));
+        }
+    }
+
+    /**
+       \brief Word-level propagation for a delayed term. The argument and result bits
+       are abstracted by their fixed value, when all bits are assigned, or by the
+       number of fixed low and high zero bits, i.e., the interval [0, 2^(sz - lz)) with
+       alignment 2^tz.
+       
+       - a * b:   tz(n) >= tz(a) + tz(b), lz(n) >= lz(a) + lz(b) - sz
+       - a udiv b: n <= a when b != 0
+       - a urem b: n <= a, and n < b when b != 0
+    */
+    void theory_bv::propagate_delayed(unsigned idx) {
+        if (m_delayed_ops[idx].m_blasted)
+            return;
+        app * n       = m_delayed_ops[idx].m_term;
+        enode * e     = ctx.get_enode(n);
+        theory_var v  = e->get_th_var(get_id());
+        theory_var v1 = get_arg_var(e, 0);
+        theory_var v2 = get_arg_var(e, 1);
+        unsigned sz   = get_bv_size(n);
+        literal_vector & expl = m_word_expl;
+        numeral a, b, val;
+        expl.reset();
+        if (get_fixed_value(v1, a) && get_fixed_value(v2, b)) {
+            push_value_literals(v1, a, expl);
+            push_value_literals(v2, b, expl);
+            unsigned j = 0;
+            for (literal l : expl) 
+                if (l != false_literal)
+                    expl[j++] = ~l;
+            expl.shrink(j);
+            eval_delayed(n, a, b, val);
+            numeral two(2);
+            for (unsigned i = 0; i < sz && !ctx.inconsistent(); ++i) {
+                propagate_word_bits(v, i, i + 1, !val.is_even(), expl);
+                val = div(val, two);
+            }
+            return;
+        }
+        literal t;
+        if (m_util.is_bv_mul(n)) {
+            unsigned tz1 = fixed_zeros(v1, false, expl);
+            unsigned tz2 = fixed_zeros(v2, false, expl);
+            propagate_word_bits(v, 0, std::min(sz, tz1 + tz2), false, expl);
+            expl.reset();
+            unsigned lz1 = fixed_zeros(v1, true, expl);
+            unsigned lz2 = fixed_zeros(v2, true, expl);
+            if (lz1 + lz2 > sz)
+                propagate_word_bits(v, 2*sz - lz1 - lz2, sz, false, expl);
+            return;
+        }
+        unsigned lz1 = fixed_zeros(v1, true, expl);
+        if (m_util.is_bv_udivi(n)) {
+            if (lz1 > 0 && find_true_bit(v2, t)) {
+                expl.push_back(t);
+                propagate_word_bits(v, sz - lz1, sz, false, expl);
+            }
+            return;
+        }
+        SASSERT(m_util.is_bv_uremi(n));
+        propagate_word_bits(v, sz - lz1, sz, false, expl);
+        expl.reset();
+        if (find_true_bit(v2, t)) {
+            unsigned lz2 = fixed_zeros(v2, true, expl);
+            expl.push_back(t);
+            propagate_word_bits(v, sz - lz2, sz, false, expl);
+        }
+    }
+
 #define MK_PARAMETRIC_UNARY(NAME, BLAST_OP)                                     \
     void theory_bv::NAME(app * n) {                                             \
         SASSERT(!ctx.e_internalized(n));                              \
@@ -840,11 +1103,11 @@ namespace smt {
         case OP_BV_NUM:         internalize_num(term); return true;
         case OP_BADD:           internalize_add(term); return true;
         case OP_BSUB:           internalize_sub(term); return true;
-        case OP_BMUL:           internalize_mul(term); return true;
+        case OP_BMUL:           if (should_delay(term)) internalize_delayed(term); else internalize_mul(term); return true;
         case OP_BSDIV_I:        internalize_sdiv(term); return true;
-        case OP_BUDIV_I:        internalize_udiv(term); return true;
+        case OP_BUDIV_I:        if (should_delay(term)) internalize_delayed(term); else internalize_udiv(term); return true;
         case OP_BSREM_I:        internalize_srem(term); return true;
-        case OP_BUREM_I:        internalize_urem(term); return true;
+        case OP_BUREM_I:        if (should_delay(term)) internalize_delayed(term); else internalize_urem(term); return true;
         case OP_BSMOD_I:        internalize_smod(term); return true;
         case OP_BAND:           internalize_and(term); return true;
         case OP_BOR:            internalize_or(term); return true;
@@ -1190,6 +1453,7 @@ namespace smt {
                 curr = curr->m_next;
             }
             propagate_bits();
+            m_delayed_propagate |= !m_delayed_ops.empty();
 
 #if WATCH_DISEQ
             if (!ctx.inconsistent() && m_diseq_watch.size() > static_cast<unsigned>(v)) {
@@ -1381,6 +1645,9 @@ namespace smt {
 
     final_check_status theory_bv::final_check_eh() {
         SASSERT(check_invariant());
+        if (!m_delayed_ops.empty() && !check_delayed_ops()) {
+            return FC_CONTINUE;
+        }
         if (m_approximates_large_bvs) {
             return FC_GIVEUP;
         }
@@ -1420,7 +1687,8 @@ namespace smt {
         m_bb(ctx.get_manager(), ctx.get_fparams()),
         m_trail_stack(*this),
         m_find(*this),
-        m_approximates_large_bvs(false) {
+        m_approximates_large_bvs(false),
+        m_delayed_propagate(false) {
         memset(m_eq_activity, 0, sizeof(m_eq_activity));
 #if WATCH_DISEQ
         memset(m_diseq_activity, 0, sizeof(m_diseq_activity));
@@ -1554,6 +1822,11 @@ namespace smt {
             }
             m_replay_diseq.reset();
         }
+        if (m_delayed_propagate) {
+            m_delayed_propagate = false;
+            for (unsigned i = 0; i < m_delayed_ops.size() && !ctx.inconsistent(); ++i) 
+                propagate_delayed(i);
+        }
     }
 
     class bit_eq_justification : public justification {
@@ -1716,6 +1989,9 @@ namespace smt {
         st.update("bv bit2core", m_stats.m_num_bit2core);
         st.update("bv->core eq", m_stats.m_num_th2core_eq);
         st.update("bv dynamic eqs", m_stats.m_num_eq_dynamic);
+        st.update("bv delayed lemmas", m_stats.m_num_delay_lemmas);
+        st.update("bv delayed blasts", m_stats.m_num_delay_blasts);
+        st.update("bv word propagations", m_stats.m_num_word_props);
     }
 
     bool theory_bv::check_assignment(theory_var v) {
@@ -31,6 +31,7 @@ namespace smt {
     struct theory_bv_stats {
         unsigned   m_num_diseq_static, m_num_diseq_dynamic, m_num_bit2core, m_num_th2core_eq, m_num_conflicts;
         unsigned   m_num_eq_dynamic;
+        unsigned   m_num_delay_lemmas, m_num_delay_blasts, m_num_word_props;
         void reset() { memset(this, 0, sizeof(theory_bv_stats)); }
         theory_bv_stats() { reset(); }
     };
@@ -134,6 +135,23 @@ namespace smt {
         svector<var_pos>         m_prop_queue;
         bool                     m_approximates_large_bvs;
 
+        /**
+           \brief Multipliers and dividers whose circuit is built on demand (smt.bv.delay).
+           
+           The term gets fresh bits when it is internalized, and final_check_eh
+           refines it with value lemmas until m_num_lemmas reaches a limit, at which
+           point the full circuit is asserted.
+        */
+        struct delayed_op {
+            app *    m_term;
+            unsigned m_num_lemmas;
+            bool     m_blasted;
+            delayed_op(app * t = nullptr):m_term(t), m_num_lemmas(0), m_blasted(false) {}
+        };
+        svector<delayed_op>      m_delayed_ops;
+        bool                     m_delayed_propagate;
+        literal_vector           m_word_expl;
+
         theory_var find(theory_var v) const { return m_find.find(v); }
         theory_var next(theory_var v) const { return m_find.next(v); }
         bool is_root(theory_var v) const { return m_find.is_root(v); }
@@ -212,6 +230,18 @@ namespace smt {
 
         bool approximate_term(app* n);
 
+        bool should_delay(app * n) const;
+        void internalize_delayed(app * n);
+        void assert_bits_eq(theory_var v, expr_ref_vector const & bits);
+        void eval_delayed(app * n, numeral const & a, numeral const & b, numeral & r) const;
+        void push_value_literals(theory_var v, numeral val, literal_vector & lits) const;
+        void blast_delayed(unsigned idx);
+        bool check_delayed_ops();
+        unsigned fixed_zeros(theory_var v, bool from_top, literal_vector & expl) const;
+        bool find_true_bit(theory_var v, literal & l) const;
+        void propagate_word_bits(theory_var v, unsigned lo, unsigned hi, bool is_true, literal_vector const & expl);
+        void propagate_delayed(unsigned idx);
+
         template<bool Signed>
         void internalize_le(app * atom);
         bool internalize_xor3(app * n, bool gate_ctx);
@@ -239,7 +269,7 @@ namespace smt {
         bool include_func_interp(func_decl* f) override;
         svector<theory_var>   m_merge_aux[2]; //!< auxiliary vector used in merge_zero_one_bits
         bool merge_zero_one_bits(theory_var r1, theory_var r2);
-        bool can_propagate() override { return !m_replay_diseq.empty(); }
+        bool can_propagate() override { return !m_replay_diseq.empty() || m_delayed_propagate; }
         void propagate() override;
 
         // -----------------------------------
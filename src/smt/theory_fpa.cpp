@@ -84,6 +84,27 @@ namespace smt {
         }
     }
 
+    bool theory_fpa::fpa2bv_converter_wrapped::get_subst(app * t, expr * & result) {
+        if (!m_th.is_lazy(t))
+            return false;
+        if (m_th.m_lazy2bv.find(t, result))
+            return true;
+        sort * s = m.get_sort(t);
+        expr_ref bv(m), r(m);
+        bv = m_th.wrap(t);
+        unsigned bv_sz = m_th.m_bv_util.get_bv_size(bv);
+        unsigned sbits = m_th.m_fpa_util.get_sbits(s);
+        r = m_util.mk_fp(m_bv_util.mk_extract(bv_sz - 1, bv_sz - 1, bv),
+                         m_bv_util.mk_extract(bv_sz - 2, sbits - 1, bv),
+                         m_bv_util.mk_extract(sbits - 2, 0, bv));
+        TRACE("t_fpa", tout << "lazy: " << mk_ismt2_pp(t, m) << "\n";);
+        m_th.m_lazy2bv.insert(t, r);
+        m.inc_ref(t);
+        m.inc_ref(r);
+        result = r;
+        return true;
+    }
+
     theory_fpa::theory_fpa(context& ctx) :
         theory(ctx, ctx.get_manager().mk_family_id("fpa")),
         m_converter(ctx.get_manager(), this),
@@ -93,7 +114,8 @@ namespace smt {
         m_fpa_util(m_converter.fu()),
         m_bv_util(m_converter.bu()),
         m_arith_util(m_converter.au()),
-        m_is_initialized(true)
+        m_is_initialized(true),
+        m_num_lazy_encodings(0)
     {
         params_ref p;
         p.set_bool("arith_lhs", true);
@@ -107,6 +129,7 @@ namespace smt {
         if (m_is_initialized) {
             dec_ref_map_key_values(m, m_conversions);
             dec_ref_collection_values(m, m_is_added_to_model);
+            dec_ref_map_key_values(m, m_lazy2bv);
 
             m_converter.reset();
             m_rw.reset();
@@ -674,13 +697,156 @@ namespace smt {
         }
         dec_ref_map_key_values(m, m_conversions);
         dec_ref_collection_values(m, m_is_added_to_model);
+        dec_ref_map_key_values(m, m_lazy2bv);
+        m_lazy_encoded.reset();
         theory::reset_eh();
     }
 
     final_check_status theory_fpa::final_check_eh() {
         TRACE("t_fpa", tout << "final_check_eh\n";);
         SASSERT(m_converter.m_extra_assertions.empty());
-        return FC_DONE;
+        bool done = true;
+        for (auto const & kv : m_lazy2bv) {
+            app * t = kv.m_key;
+            if (!m_lazy_encoded.contains(t) && ctx.e_internalized(t) && ctx.is_relevant(t) && !check_lazy(t)) {
+                encode_lazy(t);
+                done = false;
+            }
+        }
+        return done ? FC_DONE : FC_CONTINUE;
+    }
+
+    bool theory_fpa::is_lazy(app * t) const {
+        if (!ctx.get_fparams().m_fp_lazy || t->get_family_id() != get_family_id())
+            return false;
+        switch (t->get_decl_kind()) {
+        case OP_FPA_MUL:
+        case OP_FPA_DIV:
+        case OP_FPA_REM:
+        case OP_FPA_FMA:
+        case OP_FPA_SQRT:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /**
+       \brief Retrieve the value of the bit-vector (bvwrap e) from theory_bv.
+    */
+    bool theory_fpa::get_wrapped_value(expr * e, rational & r) {
+        if (m_fpa_util.is_fp(e))
+            return false;
+        app_ref w(wrap(e));
+        theory_bv * th = dynamic_cast<theory_bv*>(ctx.get_theory(m_bv_util.get_fid()));
+        return th && ctx.e_internalized(w) && th->get_fixed_value(w.get(), r);
+    }
+
+    void theory_fpa::bits2mpf(unsigned ebits, unsigned sbits, rational const & bits, scoped_mpf & f) {
+        mpf_manager & mpfm = m_fpa_util.fm();
+        unsynch_mpz_manager & mpzm = mpfm.mpz_manager();
+        scoped_mpz all_z(mpzm), sgn_z(mpzm), exp_z(mpzm), bias(mpzm);
+        mpzm.power(mpz(2), ebits - 1, bias);
+        mpzm.dec(bias);
+        mpzm.set(all_z, bits.to_mpq().numerator());
+        mpzm.machine_div2k(all_z, ebits + sbits - 1, sgn_z);
+        mpzm.mod(all_z, mpfm.m_powers2(ebits + sbits - 1), all_z);
+        mpzm.machine_div2k(all_z, sbits - 1, exp_z);
+        mpzm.mod(all_z, mpfm.m_powers2(sbits - 1), all_z);
+        scoped_mpz exp_u = exp_z - bias;
+        mpfm.set(f, ebits, sbits, mpzm.is_one(sgn_z), mpzm.get_int64(exp_u), all_z);
+    }
+
+    bool theory_fpa::get_lazy_value(expr * e, scoped_mpf & v) {
+        if (m_fpa_util.is_numeral(e, v))
+            return true;
+        rational r;
+        if (!get_wrapped_value(e, r))
+            return false;
+        sort * s = m.get_sort(e);
+        bits2mpf(m_fpa_util.get_ebits(s), m_fpa_util.get_sbits(s), r, v);
+        return true;
+    }
+
+    bool theory_fpa::get_lazy_value(expr * e, mpf_rounding_mode & rm) {
+        if (m_fpa_util.is_rm_numeral(e, rm))
+            return true;
+        rational r;
+        if (!get_wrapped_value(e, r))
+            return false;
+        switch (r.get_uint64()) {
+        case BV_RM_TIES_TO_AWAY: rm = MPF_ROUND_NEAREST_TAWAY; break;
+        case BV_RM_TIES_TO_EVEN: rm = MPF_ROUND_NEAREST_TEVEN; break;
+        case BV_RM_TO_NEGATIVE:  rm = MPF_ROUND_TOWARD_NEGATIVE; break;
+        case BV_RM_TO_POSITIVE:  rm = MPF_ROUND_TOWARD_POSITIVE; break;
+        default:                 rm = MPF_ROUND_TOWARD_ZERO; break;
+        }
+        return true;
+    }
+
+    /**
+       \brief Check whether the current values of the arguments and of (bvwrap t)
+       agree with the semantics of t. NaNs are compared by value, other results
+       by their bit pattern.
+    */
+    bool theory_fpa::check_lazy(app * t) {
+        mpf_manager & mpfm = m_fpa_util.fm();
+        mpf_rounding_mode rm = MPF_ROUND_TOWARD_ZERO;
+        scoped_mpf x(mpfm), y(mpfm), z(mpfm), val(mpfm), expected(mpfm);
+        unsigned i = 0;
+        fpa_op_kind k = static_cast<fpa_op_kind>(t->get_decl_kind());
+        if (k != OP_FPA_REM && !get_lazy_value(t->get_arg(i++), rm))
+            return false;
+        if (!get_lazy_value(t->get_arg(i++), x) || !get_lazy_value(t, val))
+            return false;
+        if (i < t->get_num_args() && !get_lazy_value(t->get_arg(i++), y))
+            return false;
+        if (i < t->get_num_args() && !get_lazy_value(t->get_arg(i++), z))
+            return false;
+        switch (k) {
+        case OP_FPA_MUL:  mpfm.mul(rm, x, y, expected); break;
+        case OP_FPA_DIV:  mpfm.div(rm, x, y, expected); break;
+        case OP_FPA_REM:  mpfm.rem(x, y, expected); break;
+        case OP_FPA_FMA:  mpfm.fma(rm, x, y, z, expected); break;
+        case OP_FPA_SQRT: mpfm.sqrt(rm, x, expected); break;
+        default: UNREACHABLE(); return false;
+        }
+        if (mpfm.is_nan(expected) || mpfm.is_nan(val))
+            return mpfm.is_nan(expected) && mpfm.is_nan(val);
+        unsynch_mpz_manager & mpzm = mpfm.mpz_manager();
+        scoped_mpz b1(mpzm), b2(mpzm);
+        mpfm.to_ieee_bv_mpz(expected, b1);
+        mpfm.to_ieee_bv_mpz(val, b2);
+        TRACE("t_fpa", tout << mk_ismt2_pp(t, m) << " := " << mpfm.to_string(val) << " expected " << mpfm.to_string(expected) << "\n";);
+        return mpzm.eq(b1, b2);
+    }
+
+    /**
+       \brief Assert the fpa2bv circuit of t, connecting it to (bvwrap t).
+    */
+    void theory_fpa::encode_lazy(app * t) {
+        TRACE("t_fpa", tout << "encoding: " << mk_ismt2_pp(t, m) << "\n";);
+        m_lazy_encoded.insert(t);
+        m_trail_stack.push(insert_obj_trail<theory_fpa, app>(m_lazy_encoded, t));
+        m_num_lazy_encodings++;
+        expr_ref_vector args(m);
+        for (expr * arg : *t) {
+            expr_ref a(m);
+            m_rw(arg, a);
+            args.push_back(a);
+        }
+        expr_ref circuit(m), sgn(m), exp(m), sig(m), cnstr(m);
+        proof_ref pr(m);
+        VERIFY(BR_DONE == m_rw.m_cfg.reduce_app(t->get_decl(), args.size(), args.c_ptr(), circuit, pr));
+        m_converter.split_fp(circuit, sgn, exp, sig);
+        expr * cargs[3] = { sgn, exp, sig };
+        cnstr = m.mk_and(m.mk_eq(wrap(t), m_bv_util.mk_concat(3, cargs)), mk_side_conditions());
+        m_th_rw(cnstr);
+        assert_cnstr(cnstr);
+    }
+
+    void theory_fpa::collect_statistics(::statistics & st) const {
+        st.update("fpa lazy encodings", m_num_lazy_encodings);
     }
 
     void theory_fpa::init_model(model_generator & mg) {
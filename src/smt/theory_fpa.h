@@ -94,6 +94,7 @@ namespace smt {
             virtual ~fpa2bv_converter_wrapped() {}
             void mk_const(func_decl * f, expr_ref & result) override;
             void mk_rm_const(func_decl * f, expr_ref & result) override;
+            bool get_subst(app * t, expr * & result) override;
         };
 
         class fpa_value_proc : public model_value_proc {
@@ -155,6 +156,9 @@ namespace smt {
         obj_map<expr, expr*>      m_conversions;
         bool                      m_is_initialized;
         obj_hashtable<func_decl>  m_is_added_to_model;
+        obj_map<app, expr*>       m_lazy2bv;      // operations without a circuit (smt.fp.lazy)
+        obj_hashtable<app>        m_lazy_encoded; // lazy operations whose circuit is asserted
+        unsigned                  m_num_lazy_encodings;
 
         final_check_status final_check_eh() override;
         bool internalize_atom(app * atom, bool gate_ctx) override;
@@ -174,6 +178,7 @@ namespace smt {
         void relevant_eh(app * n) override;
         void init_model(model_generator & m) override;
         void finalize_model(model_generator & mg) override;
+        void collect_statistics(::statistics & st) const override;
 
     public:
         theory_fpa(context& ctx);
@@ -197,6 +202,14 @@ namespace smt {
         enode* ensure_enode(expr* e);
         enode* get_root(expr* a) { return ensure_enode(a)->get_root(); }
         app* get_ite_value(expr* e);
+
+        bool is_lazy(app * t) const;
+        bool get_wrapped_value(expr * e, rational & r);
+        void bits2mpf(unsigned ebits, unsigned sbits, rational const & bits, scoped_mpf & f);
+        bool get_lazy_value(expr * e, scoped_mpf & v);
+        bool get_lazy_value(expr * e, mpf_rounding_mode & rm);
+        bool check_lazy(app * t);
+        void encode_lazy(app * t);
     };
 
 };
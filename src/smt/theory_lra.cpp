@@ -366,6 +366,7 @@ class theory_lra::imp {
             m_nla->settings().horner_subs_fixed() =           prms.arith_nl_horner_subs_fixed();            
             m_nla->settings().horner_frequency() =            prms.arith_nl_horner_frequency();
             m_nla->settings().horner_row_length_limit() =     prms.arith_nl_horner_row_length_limit();
+            m_nla->settings().horner_cache() =                prms.arith_nl_horner_cache();
             m_nla->settings().run_grobner() =                 prms.arith_nl_grobner();
             m_nla->settings().run_nra()  =                    prms.arith_nl_nra();
             m_nla->settings().grobner_subs_fixed() =          prms.arith_nl_grobner_subs_fixed();
@@ -376,6 +377,7 @@ class theory_lra::imp {
             m_nla->settings().grobner_number_of_conflicts_to_report() = prms.arith_nl_grobner_cnfl_to_report();
             m_nla->settings().grobner_quota() =               prms.arith_nl_gr_q();
             m_nla->settings().grobner_frequency() =           prms.arith_nl_grobner_frequency();
+            m_nla->settings().grobner_incremental() =         prms.arith_nl_grobner_incremental();
             m_nla->settings().expensive_patching()  =         prms.arith_nl_expp();
         }
     }
@@ -969,6 +971,10 @@ public:
         lp().settings().report_frequency = lpar.arith_rep_freq();
         lp().settings().print_statistics = lpar.arith_print_stats();
         lp().settings().cheap_eqs() = lpar.arith_cheap_eqs();
+        lp().settings().float_first() = lpar.arith_float_first();
+        lp().settings().bb_threads() = lpar.arith_bb_threads();
+        lp().settings().bb_max_nodes() = lpar.arith_bb_nodes();
+        lp().settings().cut_pool() = lpar.arith_cut_pool();
 
         // todo : do not use m_arith_branch_cut_ratio for deciding on cheap cuts
         unsigned branch_cut_ratio = ctx().get_fparams().m_arith_branch_cut_ratio;
@@ -3914,13 +3920,25 @@ public:
         st.update("arith-horner-calls", lp().settings().stats().m_horner_calls);
         st.update("arith-horner-conflicts", lp().settings().stats().m_horner_conflicts);
         st.update("arith-horner-cross-nested-forms", lp().settings().stats().m_cross_nested_forms);
+        st.update("arith-horner-cache-hits", lp().settings().stats().m_horner_cache_hits);
         st.update("arith-grobner-calls", lp().settings().stats().m_grobner_calls);
         st.update("arith-grobner-conflicts", lp().settings().stats().m_grobner_conflicts);
+        st.update("arith-grobner-reused", lp().settings().stats().m_grobner_reused);
         if (m_nla) m_nla->collect_statistics(st);
         st.update("arith-gomory-cuts", m_stats.m_gomory_cuts);
         st.update("arith-assume-eqs", m_stats.m_assume_eqs);
         st.update("arith-branch", m_stats.m_branch);
         st.update("arith-cheap-eqs", lp().settings().stats().m_cheap_eqs);
+        st.update("arith-float-first-calls", lp().settings().stats().m_float_first_calls);
+        st.update("arith-float-first-verified", lp().settings().stats().m_float_first_verified);
+        st.update("arith-bprop-inert-rows", lp().settings().stats().m_bprop_inert_rows);
+        st.update("arith-bb-calls", lp().settings().stats().m_bb_calls);
+        st.update("arith-bb-success", lp().settings().stats().m_bb_success);
+        st.update("arith-bb-nodes", lp().settings().stats().m_bb_nodes);
+        st.update("arith-cut-pool-cuts", lp().settings().stats().m_cut_pool_cuts);
+        st.update("arith-cut-pool-dominated", lp().settings().stats().m_cut_pool_dominated);
+        st.update("arith-cut-pool-reused", lp().settings().stats().m_cut_pool_reused);
+        st.update("arith-cut-pool-aged", lp().settings().stats().m_cut_pool_aged);
     }        
 
     /*
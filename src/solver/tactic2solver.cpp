@@ -21,9 +21,11 @@ Notes:
 --*/
 #include "ast/ast_translation.h"
 #include "ast/ast_pp.h"
+#include "ast/rewriter/th_rewriter.h"
 #include "tactic/tactic.h"
 #include "solver/tactic2solver.h"
 #include "solver/solver_na2as.h"
+#include "solver/solver_params.hpp"
 #include "solver/mus.h"
 
 /**
@@ -32,6 +34,10 @@ Notes:
    Every query will be solved from scratch.  So, this is not a good
    option for applications trying to solve many easy queries that a
    similar to each other.
+
+   With solver.preprocess_cache=true the simplified form of every
+   assertion is cached, so that a query that adds a few assertions to a
+   large base only simplifies the new ones before running the tactic.
 */
 
 namespace {
@@ -48,6 +54,14 @@ class tactic2solver : public solver_na2as {
     bool                         m_produce_proofs;
     bool                         m_produce_unsat_cores;
     statistics                   m_stats;
+    bool                         m_preprocess_cache;
+    scoped_ptr<th_rewriter>      m_rewriter;
+    obj_map<expr, expr*>         m_simplified;
+    expr_ref_vector              m_simplified_pinned;
+    unsigned                     m_num_cache_hits;
+    unsigned                     m_num_cache_misses;
+
+    expr * preprocess(expr * e);
     
 public:
     tactic2solver(ast_manager & m, tactic * t, params_ref const & p, bool produce_proofs, bool produce_models, bool produce_unsat_cores, symbol const & logic);
@@ -106,7 +120,11 @@ tactic2solver::tactic2solver(ast_manager & m, tactic * t, params_ref const & p,
     solver_na2as(m),
     m_assertions(m),
     m_last_assertions(m),
-    m_last_assertions_valid(false) {
+    m_last_assertions_valid(false),
+    m_preprocess_cache(false),
+    m_simplified_pinned(m),
+    m_num_cache_hits(0),
+    m_num_cache_misses(0) {
 
     m_tactic = t;
     m_logic  = logic;
@@ -115,6 +133,7 @@ tactic2solver::tactic2solver(ast_manager & m, tactic * t, params_ref const & p,
     m_produce_models      = produce_models;
     m_produce_proofs      = produce_proofs;
     m_produce_unsat_cores = produce_unsat_cores;
+    m_preprocess_cache    = solver_params(get_params()).preprocess_cache();
 }
 
 tactic2solver::~tactic2solver() {
@@ -122,6 +141,40 @@ tactic2solver::~tactic2solver() {
 
 void tactic2solver::updt_params(params_ref const & p) {
     solver::updt_params(p);
+    m_preprocess_cache = solver_params(get_params()).preprocess_cache();
+    if (m_rewriter)
+        m_rewriter->updt_params(get_params());
+}
+
+/**
+   \brief Return the simplified form of the assertion e.
+   Simplification does not depend on the other assertions, so results remain
+   valid across push/pop and are keyed by the (hash-consed) assertion.
+*/
+expr * tactic2solver::preprocess(expr * e) {
+    if (!m_preprocess_cache || m_produce_proofs)
+        return e;
+    expr * r = nullptr;
+    if (m_simplified.find(e, r)) {
+        ++m_num_cache_hits;
+        return r;
+    }
+    ast_manager & m = get_manager();
+    if (!m_rewriter)
+        m_rewriter = alloc(th_rewriter, m, get_params());
+    // forget results of assertions that were popped long ago.
+    if (m_simplified.size() > 2 * m_assertions.size() + 1000) {
+        m_simplified.reset();
+        m_simplified_pinned.reset();
+        m_rewriter->reset();
+    }
+    expr_ref s(m);
+    (*m_rewriter)(e, s);
+    ++m_num_cache_misses;
+    m_simplified_pinned.push_back(e);
+    m_simplified_pinned.push_back(s);
+    m_simplified.insert(e, s);
+    return s;
 }
 
 void tactic2solver::collect_param_descrs(param_descrs & r) {
@@ -167,7 +220,7 @@ lbool tactic2solver::check_sat_core2(unsigned num_assumptions, expr * const * as
     goal_ref g = alloc(goal, m, m_produce_proofs, m_produce_models, m_produce_unsat_cores);
 
     for (expr* e : m_assertions) {
-        g->assert_expr(e);
+        g->assert_expr(preprocess(e));
     }
     for (unsigned i = 0; i < num_assumptions; i++) {
         proof_ref pr(m.mk_asserted(assumptions[i]), m);
@@ -222,6 +275,11 @@ lbool tactic2solver::check_sat_core2(unsigned num_assumptions, expr * const * as
     }
     m_tactic->collect_statistics(m_result->m_stats);
     m_tactic->collect_statistics(m_stats);
+    if (m_preprocess_cache) {
+        m_stats.update("preprocess cache hits", m_num_cache_hits);
+        m_stats.update("preprocess cache misses", m_num_cache_misses);
+        m_num_cache_hits = m_num_cache_misses = 0;
+    }
     m_result->m_model = md;
     m_result->m_proof = pr;
     if (m_produce_unsat_cores) {
@@ -18,6 +18,9 @@ Notes:
 --*/
 #include "tactic/portfolio/default_tactic.h"
 #include "tactic/core/simplify_tactic.h"
+#include "tactic/core/propagate_values_tactic.h"
+#include "tactic/core/solve_eqs_tactic.h"
+#include "tactic/arith/propagate_ineqs_tactic.h"
 #include "tactic/smtlogics/qfbv_tactic.h"
 #include "smt/tactic/smt_tactic.h"
 #include "tactic/smtlogics/qflia_tactic.h"
@@ -32,26 +35,52 @@ Notes:
 #include "tactic/smtlogics/qfaufbv_tactic.h"
 #include "tactic/smtlogics/qfauflia_tactic.h"
 #include "tactic/fd_solver/fd_solver.h"
+#include "tactic/tactic_params.hpp"
+
+static tactic * mk_default_strategy(ast_manager & m, params_ref const & p) {
+    return cond(mk_and(mk_is_propositional_probe(), mk_not(mk_produce_proofs_probe())), mk_fd_tactic(m, p),
+           cond(mk_is_qfbv_probe(), mk_qfbv_tactic(m),
+           cond(mk_is_qfaufbv_probe(), mk_qfaufbv_tactic(m),
+           cond(mk_is_qflia_probe(), mk_qflia_tactic(m),
+           cond(mk_is_qfauflia_probe(), mk_qfauflia_tactic(m),
+           cond(mk_is_qflra_probe(), mk_qflra_tactic(m),
+           cond(mk_is_qfnra_probe(), mk_qfnra_tactic(m),
+           cond(mk_is_qfnia_probe(), mk_qfnia_tactic(m),
+           cond(mk_is_lira_probe(), mk_lira_tactic(m, p),
+           cond(mk_is_nra_probe(), mk_nra_tactic(m),
+           cond(mk_is_qffp_probe(), mk_qffp_tactic(m, p),
+           cond(mk_is_qffplra_probe(), mk_qffplra_tactic(m, p),
+           //cond(mk_is_qfufnra_probe(), mk_qfufnra_tactic(m, p),
+           and_then(mk_preamble_tactic(m), mk_smt_tactic(m))))))))))))));
+}
+
+/**
+   \brief Two branches, one eliminating variables and one propagating bounds,
+   that exchange their findings before running the default strategy.
+*/
+static tactic * mk_default_portfolio(ast_manager & m, params_ref const & p) {
+    params_ref no_ctx;
+    no_ctx.set_bool("context_solve", false);
+    tactic * eqs = and_then(mk_simplify_tactic(m),
+                            mk_propagate_values_tactic(m),
+                            using_params(mk_solve_eqs_tactic(m), no_ctx),
+                            mk_share_tactic(),
+                            mk_default_strategy(m, p));
+    tactic * bnds = and_then(mk_simplify_tactic(m),
+                             mk_propagate_ineqs_tactic(m),
+                             mk_share_tactic(),
+                             mk_default_strategy(m, p));
+    return par_share(eqs, bnds);
+}
 
 tactic * mk_default_tactic(ast_manager & m, params_ref const & p) {
     // tactic * st = using_params(mk_smt_tactic(m), p);
-    tactic * st = using_params(and_then(mk_simplify_tactic(m),
-                                        cond(mk_and(mk_is_propositional_probe(), mk_not(mk_produce_proofs_probe())), mk_fd_tactic(m, p),
-                                        cond(mk_is_qfbv_probe(), mk_qfbv_tactic(m),
-                                        cond(mk_is_qfaufbv_probe(), mk_qfaufbv_tactic(m),
-                                        cond(mk_is_qflia_probe(), mk_qflia_tactic(m),
-                                        cond(mk_is_qfauflia_probe(), mk_qfauflia_tactic(m),
-                                        cond(mk_is_qflra_probe(), mk_qflra_tactic(m),
-                                        cond(mk_is_qfnra_probe(), mk_qfnra_tactic(m),
-                                        cond(mk_is_qfnia_probe(), mk_qfnia_tactic(m),
-                                        cond(mk_is_lira_probe(), mk_lira_tactic(m, p),
-                                        cond(mk_is_nra_probe(), mk_nra_tactic(m),
-                                        cond(mk_is_qffp_probe(), mk_qffp_tactic(m, p),
-                                        cond(mk_is_qffplra_probe(), mk_qffplra_tactic(m, p),
-                                        //cond(mk_is_qfufnra_probe(), mk_qfufnra_tactic(m, p),
-                                        and_then(mk_preamble_tactic(m), mk_smt_tactic(m))))))))))))))),
-                                        // and_then(mk_preamble_tactic(m), mk_smt_tactic(m)))),
-                               p);
+    tactic_params tp(p);
+    tactic * st;
+    if (tp.default_portfolio())
+        st = using_params(mk_default_portfolio(m, p), p);
+    else
+        st = using_params(and_then(mk_simplify_tactic(m), mk_default_strategy(m, p)), p);
     return st;
 }
 
@@ -26,14 +26,105 @@ Notes:
 #include "tactic/core/elim_uncnstr_tactic.h"
 #include "tactic/core/nnf_tactic.h"
 #include "util/stopwatch.h"
+#include "util/scoped_ptr_vector.h"
+#include "ast/ast_translation.h"
 #include "tactic/sls/sls_tactic.h"
 #include "tactic/sls/sls_params.hpp"
 #include "tactic/sls/sls_engine.h"
+#ifndef SINGLE_THREAD
+#include <thread>
+#include <mutex>
+#endif
 
 class sls_tactic : public tactic {    
     ast_manager    & m;
     params_ref       m_params;
     sls_engine     * m_engine;
+    statistics       m_par_stats;
+
+#ifdef SINGLE_THREAD
+    void run_parallel(goal_ref const & g, unsigned num_threads, model_converter_ref & mc) {
+        m_engine->operator()(g, mc);
+    }
+#else
+    /**
+       \brief Run num_threads engines with different random seeds, each on a copy
+       of g in its own manager. The first engine that satisfies all assertions
+       cancels the others and its model is used.
+    */
+    void run_parallel(goal_ref const & g, unsigned num_threads, model_converter_ref & mc) {
+        if (m.has_trace_stream())
+            throw default_exception("threads and trace are incompatible");
+        sls_params p(m_params);
+        scoped_ptr_vector<ast_manager> managers;
+        scoped_limits                  scl(m.limit());
+        goal_ref_vector                goals;
+        scoped_ptr_vector<sls_engine>  engines;
+        sref_vector<model_converter>   mcs;
+        for (unsigned i = 0; i < num_threads; ++i) {
+            ast_manager * new_m = alloc(ast_manager, m, true);
+            managers.push_back(new_m);
+            ast_translation tr(m, *new_m);
+            goals.push_back(g->translate(tr));
+            params_ref q(m_params);
+            q.set_uint("random_seed", p.random_seed() + i);
+            engines.push_back(alloc(sls_engine, *new_m, q));
+            mcs.push_back(nullptr);
+            scl.push_child(&new_m->limit());
+        }
+
+        unsigned    winner = UINT_MAX;
+        std::string ex_msg;
+        bool        has_ex = false;
+        std::mutex  mux;
+
+        auto worker_thread = [&](unsigned i) {
+            model_converter_ref wmc;
+            try {
+                (*engines[i])(goals[i], wmc);
+            }
+            catch (z3_exception & ex) {
+                std::lock_guard<std::mutex> lock(mux);
+                if (i == 0) {
+                    has_ex = true;
+                    ex_msg = ex.msg();
+                }
+                return;
+            }
+            if (goals[i]->size() > 0)
+                return;
+            std::lock_guard<std::mutex> lock(mux);
+            if (winner != UINT_MAX)
+                return;
+            winner = i;
+            mcs.set(i, wmc.get());
+            for (unsigned j = 0; j < num_threads; ++j) 
+                if (j != i) 
+                    managers[j]->limit().cancel();
+        };
+
+        vector<std::thread> threads(num_threads);
+        for (unsigned i = 0; i < num_threads; ++i) 
+            threads[i] = std::thread([&, i]() { worker_thread(i); });
+        for (auto & th : threads) 
+            th.join();
+
+        for (sls_engine * e : engines)
+            e->collect_statistics(m_par_stats);
+
+        if (winner == UINT_MAX) {
+            if (has_ex && m.limit().is_canceled())
+                throw default_exception(std::move(ex_msg));
+            return;
+        }
+        IF_VERBOSE(2, verbose_stream() << "(sls :winner " << winner << ")\n";);
+        if (mcs.get(winner)) {
+            ast_translation tr(*managers[winner], m, false);
+            mc = mcs.get(winner)->translate(tr);
+        }
+        g->reset();
+    }
+#endif
 
 public:
     sls_tactic(ast_manager & _m, params_ref const & p):
@@ -67,7 +158,11 @@ public:
         tactic_report report("sls", *g);
         
         model_converter_ref mc;
-        m_engine->operator()(g, mc);
+        unsigned num_threads = sls_params(m_params).threads();
+        if (num_threads > 1 && !g->inconsistent())
+            run_parallel(g, num_threads, mc);
+        else
+            m_engine->operator()(g, mc);
         g->add(mc.get());
         g->inc_depth();
         result.push_back(g.get());
@@ -81,10 +176,12 @@ public:
     
     void collect_statistics(statistics & st) const override {
         m_engine->collect_statistics(st);
+        st.copy(m_par_stats);
     }
 
     void reset_statistics() override {
         m_engine->reset_statistics();
+        m_par_stats.reset();
     }
 
 };
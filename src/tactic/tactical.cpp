@@ -19,9 +19,18 @@ Notes:
 #include "util/scoped_timer.h"
 #include "util/cancel_eh.h"
 #include "util/scoped_ptr_vector.h"
+#include "util/union_find.h"
+#include "util/gparams.h"
+#include "util/mutex.h"
+#include "util/memory_manager.h"
+#include "util/stopwatch.h"
+#include "ast/arith_decl_plugin.h"
 #include "tactic/tactical.h"
+#include "tactic/tactic_params.hpp"
+#include <iomanip>
 #ifndef SINGLE_THREAD
 #include <thread>
+#include <mutex>
 #endif
 #include <vector>
 
@@ -369,8 +378,140 @@ tactic * par(unsigned num, tactic * const * ts) {
     throw default_exception("par_tactical is unavailable in single threaded mode");
 }
 
+tactic * par_share(unsigned num, tactic * const * ts) {
+    throw default_exception("par_share is unavailable in single threaded mode");
+}
+
+tactic * mk_share_tactic() {
+    return mk_skip_tactic();
+}
+
 #else
 
+/**
+   \brief Facts exchanged between the branches of par_share.
+   They are stored in a private manager and translated on the way in and out.
+*/
+class shared_facts {
+    std::mutex          m_mux;
+    ast_manager         m;
+    expr_ref_vector     m_facts;
+    unsigned_vector     m_owner;
+    obj_hashtable<expr> m_known;
+
+    static const unsigned max_facts = 10000;
+
+public:
+    shared_facts(ast_manager & src): m(src, true), m_facts(m) {}
+
+    void export_facts(ast_manager & src, unsigned branch, expr_ref_vector const & facts) {
+        std::lock_guard<std::mutex> lock(m_mux);
+        ast_translation tr(src, m, false);
+        for (expr * f : facts) {
+            if (m_facts.size() >= max_facts)
+                break;
+            expr_ref g(tr(f), m);
+            if (m_known.contains(g))
+                continue;
+            m_facts.push_back(g);
+            m_known.insert(g);
+            m_owner.push_back(branch);
+        }
+    }
+
+    void import_facts(ast_manager & dst, unsigned branch, unsigned & head, expr_ref_vector & facts) {
+        std::lock_guard<std::mutex> lock(m_mux);
+        ast_translation tr(m, dst, false);
+        for (; head < m_facts.size(); ++head)
+            if (m_owner[head] != branch)
+                facts.push_back(tr(m_facts.get(head)));
+    }
+};
+
+struct share_context {
+    shared_facts * m_facts;
+    unsigned       m_branch;
+    unsigned       m_head;
+};
+
+// set by par_share for the thread running a branch.
+static thread_local share_context * g_share_context = nullptr;
+
+class share_tactic : public tactic {
+
+    // unit literals, (= x v), (<= x k) and (>= x k) and their negations.
+    static app * shared_const(ast_manager & m, expr * f) {
+        arith_util a(m);
+        expr * arg = nullptr, * lhs = nullptr, * rhs = nullptr;
+        if (m.is_not(f, arg))
+            f = arg;
+        if (is_uninterp_const(f))
+            return to_app(f);
+        if (m.is_eq(f, lhs, rhs) || a.is_le(f, lhs, rhs) || a.is_ge(f, lhs, rhs)) {
+            if (is_uninterp_const(rhs) && m.is_value(lhs))
+                std::swap(lhs, rhs);
+            if (is_uninterp_const(lhs) && m.is_value(rhs))
+                return to_app(lhs);
+        }
+        return nullptr;
+    }
+
+    struct const_proc {
+        obj_hashtable<func_decl> & m_consts;
+        const_proc(obj_hashtable<func_decl> & c): m_consts(c) {}
+        void operator()(var * v) {}
+        void operator()(quantifier * q) {}
+        void operator()(app * a) { if (is_uninterp_const(a)) m_consts.insert(a->get_decl()); }
+    };
+
+public:
+    void operator()(goal_ref const & g, goal_ref_buffer & result) override {
+        result.push_back(g.get());
+        share_context * ctx = g_share_context;
+        if (!ctx || g->proofs_enabled())
+            return;
+        ast_manager & m = g->m();
+        expr_ref_vector facts(m), imported(m);
+        obj_hashtable<func_decl> consts;
+        const_proc proc(consts);
+        expr_mark visited;
+        if (g->inconsistent()) {
+            if (!g->dep(0))
+                facts.push_back(m.mk_false());
+        }
+        else {
+            for (unsigned i = 0; i < g->size(); ++i) {
+                expr * f = g->form(i);
+                if (!g->dep(i) && shared_const(m, f))
+                    facts.push_back(f);
+                for_each_expr(proc, visited, f);
+            }
+        }
+        ctx->m_facts->export_facts(m, ctx->m_branch, facts);
+        if (g->inconsistent())
+            return;
+        ctx->m_facts->import_facts(m, ctx->m_branch, ctx->m_head, imported);
+        unsigned num_imported = 0;
+        for (expr * f : imported) {
+            app * x = shared_const(m, f);
+            if (m.is_false(f) || (x && consts.contains(x->get_decl()))) {
+                g->assert_expr(f);
+                ++num_imported;
+            }
+        }
+        IF_VERBOSE(10, verbose_stream() << "(share :branch " << ctx->m_branch << " :exported " << facts.size()
+                   << " :imported " << num_imported << ")\n";);
+    }
+
+    void cleanup() override {}
+
+    tactic * translate(ast_manager & m) override { return this; }
+};
+
+tactic * mk_share_tactic() {
+    return alloc(share_tactic);
+}
+
 enum par_exception_kind {
     TACTIC_EX,
     DEFAULT_EX,
@@ -381,9 +522,10 @@ class par_tactical : public or_else_tactical {
 
 	std::string        ex_msg;
 	unsigned           error_code;
+    bool               m_share;
 
 public:
-    par_tactical(unsigned num, tactic * const * ts):or_else_tactical(num, ts) {
+    par_tactical(unsigned num, tactic * const * ts, bool share = false):or_else_tactical(num, ts), m_share(share) {
 		error_code = 0;
 	}
     ~par_tactical() override {}
@@ -422,11 +564,17 @@ public:
         par_exception_kind ex_kind = DEFAULT_EX;
 
         std::mutex         mux;
+        scoped_ptr<shared_facts> facts;
+        if (m_share)
+            facts = alloc(shared_facts, m);
 
         auto worker_thread = [&](unsigned i) {
             goal_ref_buffer     _result;                        
             goal_ref in_copy = in_copies[i];
             tactic & t = *(ts.get(i));
+            share_context sctx = { facts.get(), i, 0 };
+            if (facts)
+                g_share_context = &sctx;
             
             try {
                 t(in_copy, _result);
@@ -471,6 +619,7 @@ public:
                     ex_msg = z3_ex.msg();
                 }
             }
+            g_share_context = nullptr;
         };
 
         vector<std::thread> threads(sz);
@@ -492,13 +641,22 @@ public:
         }
     }    
 
-    tactic * translate(ast_manager & m) override { return translate_core<par_tactical>(m); }
+    tactic * translate(ast_manager & m) override {
+        sref_vector<tactic> new_ts;
+        for (tactic* curr : m_ts) 
+            new_ts.push_back(curr->translate(m));
+        return alloc(par_tactical, new_ts.size(), new_ts.c_ptr(), m_share);
+    }
 };
 
 tactic * par(unsigned num, tactic * const * ts) {
     return alloc(par_tactical, num, ts);
 }
 
+tactic * par_share(unsigned num, tactic * const * ts) {
+    return alloc(par_tactical, num, ts, true);
+}
+
 #endif
 
 tactic * par(tactic * t1, tactic * t2) {
@@ -516,6 +674,11 @@ tactic * par(tactic * t1, tactic * t2, tactic * t3, tactic * t4) {
     return par(4, ts);
 }
 
+tactic * par_share(tactic * t1, tactic * t2) {
+    tactic * ts[2] = { t1, t2 };
+    return par_share(2, ts);
+}
+
 #ifdef SINGLE_THREAD
 
 tactic * par_and_then(tactic * t1, tactic * t2) {
@@ -906,6 +1069,217 @@ tactic * repeat(tactic * t, unsigned max) {
     return alloc(repeat_tactical, t, max);
 }
 
+#ifdef SINGLE_THREAD
+
+tactic * par_shard(tactic * t, unsigned num_threads) {
+    throw default_exception("par_shard is unavailable in single threaded mode");
+}
+
+#else
+
+class par_shard_tactical : public unary_tactical {
+    unsigned   m_num_threads;
+    statistics m_stats;
+
+    struct decl_proc {
+        obj_map<func_decl, unsigned> & m_ids;
+        basic_union_find &             m_uf;
+        unsigned                       m_first;
+        decl_proc(obj_map<func_decl, unsigned> & ids, basic_union_find & uf):
+            m_ids(ids), m_uf(uf), m_first(UINT_MAX) {}
+        void operator()(var * v) {}
+        void operator()(quantifier * q) {}
+        void operator()(app * a) {
+            if (a->get_family_id() != null_family_id)
+                return;
+            unsigned id = 0;
+            if (!m_ids.find(a->get_decl(), id)) {
+                id = m_uf.mk_var();
+                m_ids.insert(a->get_decl(), id);
+            }
+            if (m_first == UINT_MAX)
+                m_first = id;
+            else
+                m_uf.merge(m_first, id);
+        }
+    };
+
+    /**
+       \brief Partition the formulas of g into at most n bins such that formulas
+       sharing an uninterpreted symbol end up in the same bin.
+       Components are assigned largest first to the least loaded bin.
+    */
+    void partition(goal const & g, unsigned n, vector<unsigned_vector> & bins) {
+        obj_map<func_decl, unsigned> ids;
+        basic_union_find uf;
+        unsigned_vector comp_of;
+        for (unsigned i = 0; i < g.size(); ++i) {
+            decl_proc proc(ids, uf);
+            expr_mark visited;
+            for_each_expr(proc, visited, g.form(i));
+            comp_of.push_back(proc.m_first == UINT_MAX ? uf.mk_var() : proc.m_first);
+        }
+        u_map<unsigned> root2comp;
+        vector<unsigned_vector> comps;
+        for (unsigned i = 0; i < g.size(); ++i) {
+            unsigned r = uf.find(comp_of[i]), c = 0;
+            if (!root2comp.find(r, c)) {
+                c = comps.size();
+                root2comp.insert(r, c);
+                comps.push_back(unsigned_vector());
+            }
+            comps[c].push_back(i);
+        }
+        unsigned_vector order;
+        for (unsigned c = 0; c < comps.size(); ++c)
+            order.push_back(c);
+        std::sort(order.begin(), order.end(), [&](unsigned a, unsigned b) { return comps[a].size() > comps[b].size(); });
+        bins.reset();
+        bins.resize(std::min(n, comps.size()));
+        for (unsigned c : order) {
+            unsigned best = 0;
+            for (unsigned j = 1; j < bins.size(); ++j)
+                if (bins[j].size() < bins[best].size())
+                    best = j;
+            bins[best].append(comps[c]);
+        }
+    }
+
+public:
+    par_shard_tactical(tactic * t, unsigned num_threads):
+        unary_tactical(t),
+        m_num_threads(num_threads == 0 ? std::thread::hardware_concurrency() : num_threads) {}
+
+    void operator()(goal_ref const & in, goal_ref_buffer & result) override {
+        ast_manager & m = in->m();
+        vector<unsigned_vector> bins;
+        if (m_num_threads > 1 && !in->proofs_enabled() && !in->inconsistent() && !m.has_trace_stream())
+            partition(*in, m_num_threads, bins);
+        if (bins.size() <= 1) {
+            m_t->operator()(in, result);
+            return;
+        }
+        unsigned sz = bins.size();
+        TRACE("par_shard", tout << "shards: " << sz << "\n";);
+        IF_VERBOSE(10, verbose_stream() << "(par-shard :shards " << sz << ")\n";);
+
+        scoped_ptr_vector<ast_manager> managers;
+        scoped_limits                  scl(m.limit());
+        goal_ref_vector                shards;
+        tactic_ref_vector              ts;
+        for (unsigned i = 0; i < sz; ++i) {
+            goal_ref shard = alloc(goal, m, false, in->models_enabled(), in->unsat_core_enabled());
+            shard->set_depth(in->depth());
+            for (unsigned j : bins[i])
+                shard->assert_expr(in->form(j), in->dep(j));
+            ast_manager * new_m = alloc(ast_manager, m, true);
+            managers.push_back(new_m);
+            ast_translation translator(m, *new_m);
+            shards.push_back(shard->translate(translator));
+            ts.push_back(m_t->translate(*new_m));
+            scl.push_child(&new_m->limit());
+        }
+
+        scoped_ptr_vector<goal_ref_buffer> results;
+        for (unsigned i = 0; i < sz; ++i)
+            results.push_back(alloc(goal_ref_buffer));
+        std::mutex         mux;
+        bool               failed = false;
+        par_exception_kind ex_kind = DEFAULT_EX;
+        unsigned           error_code = 0;
+        std::string        ex_msg;
+
+        auto worker_thread = [&](unsigned i) {
+            par_exception_kind kind = DEFAULT_EX;
+            unsigned code = 0;
+            std::string msg;
+            try {
+                (*ts.get(i))(shards.get(i), *results[i]);
+                return;
+            }
+            catch (tactic_exception & ex) {
+                kind = TACTIC_EX;
+                msg = ex.msg();
+            }
+            catch (z3_error & err) {
+                kind = ERROR_EX;
+                code = err.error_code();
+            }
+            catch (z3_exception & z3_ex) {
+                msg = z3_ex.msg();
+            }
+            std::lock_guard<std::mutex> lock(mux);
+            if (!failed) {
+                failed = true;
+                ex_kind = kind;
+                error_code = code;
+                ex_msg = msg;
+                for (unsigned j = 0; j < sz; ++j)
+                    if (j != i)
+                        managers[j]->limit().cancel();
+            }
+        };
+
+        vector<std::thread> threads(sz);
+        for (unsigned i = 0; i < sz; ++i)
+            threads[i] = std::thread([&, i]() { worker_thread(i); });
+        for (unsigned i = 0; i < sz; ++i)
+            threads[i].join();
+
+        for (tactic * t : ts)
+            t->collect_statistics(m_stats);
+
+        if (failed) {
+            switch (ex_kind) {
+            case ERROR_EX: throw z3_error(error_code);
+            case TACTIC_EX: throw tactic_exception(std::move(ex_msg));
+            default:
+                throw default_exception(std::move(ex_msg));
+            }
+        }
+
+        for (goal_ref_buffer * r : results) {
+            if (r->size() != 1) {
+                // the shards can only be merged if each produced a single subgoal.
+                m_t->operator()(in, result);
+                return;
+            }
+        }
+
+        goal_ref merged = alloc(goal, *in, true);
+        for (unsigned i = 0; i < sz && !merged->inconsistent(); ++i) {
+            ast_translation translator(*managers[i], m, false);
+            goal_ref r = (*results[i])[0]->translate(translator);
+            merged->updt_prec(r->prec());
+            merged->add(r->mc());
+            merged->add(r->dc());
+            for (unsigned j = 0; j < r->size(); ++j)
+                merged->assert_expr(r->form(j), r->dep(j));
+        }
+        result.push_back(merged.get());
+    }
+
+    void collect_statistics(statistics & st) const override {
+        m_t->collect_statistics(st);
+        st.copy(m_stats);
+    }
+
+    void reset_statistics() override {
+        m_t->reset_statistics();
+        m_stats.reset();
+    }
+
+    tactic * translate(ast_manager & m) override {
+        return alloc(par_shard_tactical, m_t->translate(m), m_num_threads);
+    }
+};
+
+tactic * par_shard(tactic * t, unsigned num_threads) {
+    return alloc(par_shard_tactical, t, num_threads);
+}
+
+#endif
+
 class fail_if_branching_tactical : public unary_tactical {
     unsigned m_threshold;
 public:
@@ -1035,6 +1409,180 @@ tactic * annotate_tactic(char const* name, tactic * t) {
     return alloc(annotate_tactical, name, t);
 }
 
+namespace {
+    struct tactic_record {
+        std::string        m_path;
+        std::string        m_time_key;
+        std::string        m_max_memory_key;
+        std::string        m_count_key;
+        std::string        m_subgoals_key;
+        std::string        m_size_before_key;
+        std::string        m_size_after_key;
+        double             m_seconds;
+        unsigned long long m_max_memory;
+        unsigned           m_count;
+        unsigned           m_subgoals;
+        unsigned long long m_size_before;
+        unsigned long long m_size_after;
+        tactic_record(std::string const & path):
+            m_path(path),
+            m_time_key("tactic " + path + " time"),
+            m_max_memory_key("tactic " + path + " max memory"),
+            m_count_key("tactic " + path + " count"),
+            m_subgoals_key("tactic " + path + " subgoals"),
+            m_size_before_key("tactic " + path + " size before"),
+            m_size_after_key("tactic " + path + " size after") {
+            reset();
+        }
+        void reset() {
+            m_seconds     = 0;
+            m_max_memory  = 0;
+            m_count       = 0;
+            m_subgoals    = 0;
+            m_size_before = 0;
+            m_size_after  = 0;
+        }
+    };
+}
+
+static DECLARE_INIT_MUTEX(g_tactic_profile_mux);
+// records are only deleted by finalize since statistics objects keep pointers to their keys.
+static ptr_vector<tactic_record> * g_tactic_records = nullptr;
+static thread_local std::string    g_tactic_path;
+
+static double to_mb(unsigned long long sz) {
+    return static_cast<double>(sz) / static_cast<double>(1024*1024);
+}
+
+bool tactic_profiler::enabled() {
+    tactic_params tp(gparams::get_module("tactic"));
+    return tp.profile();
+}
+
+void tactic_profiler::reset() {
+    lock_guard lock(*g_tactic_profile_mux);
+    if (g_tactic_records)
+        for (tactic_record * r : *g_tactic_records)
+            r->reset();
+}
+
+void tactic_profiler::collect_statistics(statistics & st) {
+    lock_guard lock(*g_tactic_profile_mux);
+    if (!g_tactic_records)
+        return;
+    for (tactic_record * r : *g_tactic_records) {
+        st.update(r->m_time_key.c_str(), r->m_seconds);
+        st.update(r->m_max_memory_key.c_str(), to_mb(r->m_max_memory));
+        st.update(r->m_count_key.c_str(), r->m_count);
+        st.update(r->m_subgoals_key.c_str(), r->m_subgoals);
+        st.update(r->m_size_before_key.c_str(), static_cast<double>(r->m_size_before));
+        st.update(r->m_size_after_key.c_str(), static_cast<double>(r->m_size_after));
+    }
+}
+
+void tactic_profiler::display(std::ostream & out) {
+    lock_guard lock(*g_tactic_profile_mux);
+    if (!g_tactic_records)
+        return;
+    for (tactic_record * r : *g_tactic_records) {
+        if (r->m_count == 0)
+            continue;
+        out << "(tactic " << r->m_path
+            << " :count " << r->m_count
+            << " :time " << std::fixed << std::setprecision(2) << r->m_seconds
+            << " :max-memory " << std::fixed << std::setprecision(2) << to_mb(r->m_max_memory)
+            << " :subgoals " << r->m_subgoals
+            << " :size-before " << r->m_size_before
+            << " :size-after " << r->m_size_after << ")\n";
+    }
+}
+
+void tactic_profiler::finalize() {
+    if (g_tactic_records) {
+        std::for_each(g_tactic_records->begin(), g_tactic_records->end(), delete_proc<tactic_record>());
+        dealloc(g_tactic_records);
+        g_tactic_records = nullptr;
+    }
+}
+
+class profile_tactical : public unary_tactical {
+    std::string m_name;
+    bool        m_root;   // outermost profiled tactic of the last call
+
+    void record(stopwatch const & watch, unsigned long long start_memory, unsigned long long start_max_memory,
+                unsigned size_before, goal_ref_buffer const & result) {
+        unsigned long long end_memory     = memory::get_allocation_size();
+        unsigned long long end_max_memory = memory::get_max_used_memory();
+        unsigned long long max_memory = end_max_memory > start_max_memory ? end_max_memory : std::max(start_memory, end_memory);
+        unsigned long long size_after = 0;
+        for (goal * g : result)
+            size_after += g->num_exprs();
+        lock_guard lock(*g_tactic_profile_mux);
+        if (!g_tactic_records)
+            g_tactic_records = alloc(ptr_vector<tactic_record>);
+        tactic_record * rec = nullptr;
+        for (tactic_record * r : *g_tactic_records) {
+            if (r->m_path == g_tactic_path) {
+                rec = r;
+                break;
+            }
+        }
+        if (!rec) {
+            rec = alloc(tactic_record, g_tactic_path);
+            g_tactic_records->push_back(rec);
+        }
+        rec->m_seconds     += watch.get_seconds();
+        rec->m_max_memory   = std::max(rec->m_max_memory, max_memory);
+        rec->m_count++;
+        rec->m_subgoals    += result.size();
+        rec->m_size_before += size_before;
+        rec->m_size_after  += size_after;
+    }
+
+public:
+    profile_tactical(char const * name, tactic * t):
+        unary_tactical(t), m_name(name), m_root(false) {}
+
+    void operator()(goal_ref const & in, goal_ref_buffer & result) override {
+        size_t old_path_len = g_tactic_path.size();
+        m_root = old_path_len == 0;
+        if (!m_root)
+            g_tactic_path += "/";
+        g_tactic_path += m_name;
+        unsigned size_before = in->num_exprs();
+        unsigned long long start_memory     = memory::get_allocation_size();
+        unsigned long long start_max_memory = memory::get_max_used_memory();
+        stopwatch watch;
+        watch.start();
+        try {
+            m_t->operator()(in, result);
+        }
+        catch (...) {
+            watch.stop();
+            record(watch, start_memory, start_max_memory, size_before, result);
+            g_tactic_path.resize(old_path_len);
+            throw;
+        }
+        watch.stop();
+        record(watch, start_memory, start_max_memory, size_before, result);
+        g_tactic_path.resize(old_path_len);
+    }
+
+    void collect_statistics(statistics & st) const override {
+        m_t->collect_statistics(st);
+        if (m_root)
+            tactic_profiler::collect_statistics(st);
+    }
+
+    tactic * translate(ast_manager & m) override {
+        return alloc(profile_tactical, m_name.c_str(), m_t->translate(m));
+    }
+};
+
+tactic * profile_tactic(char const * name, tactic * t) {
+    return alloc(profile_tactical, name, t);
+}
+
 class cond_tactical : public binary_tactical {
     probe_ref m_p;
 public:
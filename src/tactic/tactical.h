@@ -15,6 +15,8 @@ Author:
 
 Notes:
 
+    ADD_FINALIZER('tactic_profiler::finalize();')
+
 --*/
 #pragma once
 
@@ -59,11 +61,72 @@ tactic * par(tactic * t1, tactic * t2, tactic * t3, tactic * t4);
 tactic * par_and_then(unsigned num, tactic * const * ts);
 tactic * par_and_then(tactic * t1, tactic * t2);
 
+/**
+   \brief Portfolio version of par: the branches exchange unit literals,
+   equalities with values and bounds at the share points they reach
+   (see mk_share_tactic). The first branch to finish wins and the other
+   branches are canceled.
+*/
+tactic * par_share(unsigned num, tactic * const * ts);
+tactic * par_share(tactic * t1, tactic * t2);
+
+/**
+   \brief Share point of par_share. Exports the bounded facts of the current
+   goal to the other branches and asserts the facts they exported.
+   Outside of par_share it behaves like skip.
+
+   \remark The exported facts must be consequences of the goal given to par_share,
+   so share should only be preceded by tactics that preserve them (e.g.,
+   simplify, propagate-values, propagate-ineqs, solve-eqs without context solving).
+*/
+tactic * mk_share_tactic();
+
+/*
+  ADD_TACTIC("share", "exchange units, equalities and bounds between the branches of par-share.", "mk_share_tactic()")
+*/
+
+/**
+   \brief Split the goal into groups of formulas that do not share uninterpreted
+   symbols, apply t to at most num_threads groups in parallel and merge the
+   results. t must produce a single subgoal per group (e.g., solve-eqs,
+   propagate-values), otherwise it is applied to the whole goal.
+   num_threads == 0 uses the number of hardware threads.
+*/
+tactic * par_shard(tactic * t, unsigned num_threads = 0);
+
 tactic * try_for(tactic * t, unsigned msecs);
 tactic * clean(tactic * t);
 tactic * using_params(tactic * t, params_ref const & p);
 tactic * annotate_tactic(char const* name, tactic * t);
 
+/**
+   \brief Behaves like t and records its profile under name.
+   Profiled tactics nest: a tactic "simplify" executed inside the
+   profiled tactic "then" is recorded as "then/simplify".
+*/
+tactic * profile_tactic(char const * name, tactic * t);
+
+/**
+   \brief Profile of the tactics created by profile_tactic: number of calls,
+   time, peak memory, subgoals produced and goal size (number of
+   expressions) before and after the tactic.
+*/
+class tactic_profiler {
+public:
+    /**
+       \brief Return true if the tactics created from SMT2 and the API should be profiled (tactic.profile).
+    */
+    static bool enabled();
+    static void reset();
+    /**
+       \brief Add entries "tactic <path> time", "tactic <path> max memory", "tactic <path> count",
+       "tactic <path> subgoals", "tactic <path> size before" and "tactic <path> size after".
+    */
+    static void collect_statistics(statistics & st);
+    static void display(std::ostream & out);
+    static void finalize();
+};
+
 // Create a tactic that fails if the result returned by probe p is true.
 tactic * fail_if(probe * p);
 tactic * fail_if_not(probe * p);
@@ -628,6 +628,40 @@ static void tst_sturm() {
 
 
 
+static void tst_compare_sturm() {
+    reslimit rl;
+    unsynch_mpq_manager        qm;
+    params_ref                 ps;
+    ps.set_bool("factor", false);
+    polynomial::manager        pm(rl, qm);
+    algebraic_numbers::manager am(rl, qm, ps);
+    polynomial_ref x(pm);
+    x = pm.mk_polynomial(pm.mk_var());
+    polynomial_ref p(pm), q(pm), r(pm);
+    p = (x^2) - 2;
+    q = ((x^2) - 2) * ((x^2) - 3);
+    r = 100000000*(x^2) - 200000001;
+    scoped_anum_vector rp(am), rq(am), rr(am);
+    am.isolate_roots(p, rp);
+    am.isolate_roots(q, rq);
+    am.isolate_roots(r, rr);
+    // the positive square root of 2 is the last root of p and the third root of q
+    scoped_anum a(am), b(am);
+    am.set(a, rp[1]);
+    am.set(b, rq[2]);
+    ENSURE(am.eq(a, b));
+    ENSURE(am.eq(a, b));
+    // close roots need the Sturm-Tarski sequence, which is kept for the next comparison of the same polynomials
+    am.set(b, rr[1]);
+    ENSURE(am.lt(a, b));
+    am.set(a, rp[1]);
+    am.set(b, rr[1]);
+    ENSURE(am.lt(a, b));
+    statistics st;
+    am.collect_statistics(st);
+    st.display(std::cout);
+}
+
 void tst_algebraic() {
     tst_sturm();
 
@@ -638,6 +672,7 @@ void tst_algebraic() {
     // enable_trace("mpz_mul2k");
     // enable_trace("mpz_gcd");
     tst_root();
+    tst_compare_sturm();
     tst_isolate_roots();
     ex1();
     tst_eval_sign();
@@ -131,6 +131,43 @@ static void tst5() {
     m.del(arr3);
 }
 
+static void tst6() {
+    ast_manager m;
+    sort_ref b(m.mk_bool_sort(), m);
+    app_ref a(m.mk_const(symbol("a"), b.get()), m);
+    app_ref n(m.mk_not(a), m);
+    app_ref f(m.mk_and(n, a), m);
+    ENSURE(a->get_depth() == 1 && a->is_ground());
+    ENSURE(n->get_depth() == 2 && n->is_ground());
+    ENSURE(f->get_depth() == 3 && f->is_ground());
+    ENSURE(!f->has_quantifiers() && !f->has_labels());
+    ENSURE(f->get_size() == sizeof(app) + 2 * sizeof(expr*));
+    app_ref g(m.mk_and(f, m.mk_var(0, b.get())), m);
+    ENSURE(g->get_depth() == 4 && !g->is_ground());
+}
+
+static void tst7() {
+    ast_manager m;
+    sort_ref b(m.mk_bool_sort(), m);
+    m.set_deferred_gc(true, 4);
+    unsigned num_asts = m.get_num_asts();
+    expr_ref f(m.mk_const(symbol("a"), b.get()), m);
+    for (unsigned i = 0; i < 100; ++i)
+        f = m.mk_not(f);
+    ENSURE(m.get_num_deferred_nodes() == 0);
+    f = nullptr;
+    ENSURE(m.get_num_deferred_nodes() == 1);
+    ENSURE(m.get_num_asts() < num_asts + 102);
+    // a new node triggers a bounded slice
+    expr_ref c(m.mk_const(symbol("c"), b.get()), m);
+    ENSURE(m.get_num_deferred_nodes() == 1);
+    ENSURE(!m.gc_slice(10));
+    m.flush_deferred_gc();
+    ENSURE(m.get_num_deferred_nodes() == 0);
+    c = nullptr;
+    m.set_deferred_gc(false);
+    ENSURE(m.get_num_asts() == num_asts);
+}
 
 struct foo {
     unsigned       m_id; 
@@ -153,5 +190,7 @@ void tst_ast() {
     tst3();
     tst4();
     tst5();
+    tst6();
+    tst7();
 }
 
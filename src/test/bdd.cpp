@@ -73,6 +73,20 @@ namespace dd {
         std::cout << c1 << "\n";
         std::cout << c1.bdd_size() << "\n";
     }
+
+    static void test_translate() {
+        bdd_manager m(20);
+        bdd v0 = m.mk_var(0);
+        bdd v1 = m.mk_var(1);
+        bdd v2 = m.mk_var(2);
+        bdd c1 = (v0 && !v1) || (v1 && v2);
+        bdd_manager m1(20);
+        bdd c2 = m1.translate(c1);
+        std::cout << c1 << "\n" << c2 << "\n";
+        SASSERT(m.translate(c2) == c1);
+        SASSERT(m1.translate(!c1) == !c2);
+        SASSERT(m.translate(c2 && m1.mk_var(0)) == (c1 && v0));
+    }
 }
 
 void tst_bdd() {
@@ -80,4 +94,5 @@ void tst_bdd() {
     dd::test2();
     dd::test3();
     dd::test4();
+    dd::test_translate();
 }
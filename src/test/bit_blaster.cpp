@@ -18,6 +18,11 @@ Revision History:
 --*/
 
 #include "ast/rewriter/bit_blaster/bit_blaster.h"
+#include "ast/rewriter/bit_blaster/bit_blaster_rewriter.h"
+#include "ast/rewriter/expr_safe_replace.h"
+#include "ast/rewriter/th_rewriter.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/for_each_expr.h"
 #include "ast/ast_pp.h"
 #include "ast/ast_ll_pp.h"
 
@@ -113,7 +118,72 @@ void tst_sh(ast_manager & m, unsigned sz) {
 //     TRACE("bit_blaster", tout << "ashr " << c.size() << "\n"; display(tout, c, false););
 }
 
+static void bind_bits(ast_manager & m, expr * bits, unsigned val, expr_safe_replace & sub) {
+    app * a = to_app(bits);
+    for (unsigned i = 0; i < a->get_num_args(); ++i) 
+        sub.insert(a->get_arg(i), (val & (1u << i)) ? m.mk_true() : m.mk_false());
+}
+
+/**
+   \brief Check that blasting with two-level AIG minimization agrees with 
+   plain blasting on all values of x and y.
+*/
+static void tst_blast_aig(ast_manager & m, expr * e, func_decl * x, func_decl * y, unsigned sz) {
+    th_rewriter rw(m);
+    expr_ref_vector values(m);
+    unsigned num_exprs[2];
+    for (unsigned k = 0; k < 2; ++k) {
+        params_ref p;
+        p.set_bool("blast_aig", k == 1);
+        bit_blaster_rewriter blaster(m, p);
+        expr_ref r(m);
+        proof_ref pr(m);
+        blaster.start_rewrite();
+        blaster(e, r, pr);
+        obj_map<func_decl, expr*> const2bits;
+        ptr_vector<func_decl> newbits;
+        blaster.end_rewrite(const2bits, newbits);
+        num_exprs[k] = get_num_exprs(r);
+        unsigned i = 0;
+        for (unsigned vx = 0; vx < (1u << sz); ++vx) {
+            for (unsigned vy = 0; vy < (1u << sz); ++vy, ++i) {
+                expr_safe_replace sub(m);
+                bind_bits(m, const2bits[x], vx, sub);
+                bind_bits(m, const2bits[y], vy, sub);
+                expr_ref v(m);
+                sub(r, v);
+                rw(v);
+                if (k == 0) 
+                    values.push_back(v);
+                else 
+                    ENSURE(values.get(i) == v);
+            }
+        }
+    }
+    std::cout << mk_pp(e, m) << " plain: " << num_exprs[0] << " aig: " << num_exprs[1] << "\n";
+}
+
+static void tst_blast_aig() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    unsigned sz = 4;
+    sort_ref s(bv.mk_sort(sz), m);
+    func_decl_ref x(m.mk_const_decl(symbol("x"), s), m);
+    func_decl_ref y(m.mk_const_decl(symbol("y"), s), m);
+    expr_ref a(m.mk_const(x), m), b(m.mk_const(y), m), e(m);
+    e = bv.mk_bv_mul(a, b);
+    tst_blast_aig(m, e, x, y, sz);
+    e = bv.mk_bv_add(a, bv.mk_bv_mul(a, b));
+    tst_blast_aig(m, e, x, y, sz);
+    e = m.mk_app(bv.get_fid(), OP_BUREM_I, a, b);
+    tst_blast_aig(m, e, x, y, sz);
+    e = m.mk_app(bv.get_fid(), OP_BUDIV_I, bv.mk_bv_add(a, b), b);
+    tst_blast_aig(m, e, x, y, sz);
+}
+
 void tst_bit_blaster() {
+    tst_blast_aig();
     ast_manager m;
     tst_adder(m, 4);
     tst_multiplier(m, 4);
@@ -16,13 +16,16 @@ Author:
 Revision History:
 
 --*/
-#ifdef _WINDOWS
 #include<iostream>
 #include<unordered_set>
 #include<stdlib.h>
 
 #include "util/hashtable.h"
+#include "util/robin_hood_hashtable.h"
+#include "util/obj_hashtable.h"
+#include "util/stopwatch.h"
 
+#ifdef _WINDOWS
 
 struct int_hash_proc { unsigned operator()(int x) const { return x * 3; } };
 typedef int_hashtable<int_hash_proc, default_eq<int> > int_set;
@@ -119,13 +122,127 @@ static void tst3() {
     ENSURE(h2.size() == 2);
 }
 
+#endif
+
+struct rh_int_hash_proc { unsigned operator()(int x) const { return x * 3; } };
+typedef robin_hood_hashtable<int_hash_entry<INT_MIN, INT_MIN + 1>, rh_int_hash_proc, default_eq<int> > rh_int_set;
+typedef core_hashtable<int_hash_entry<INT_MIN, INT_MIN + 1>, rh_int_hash_proc, default_eq<int> > core_int_set;
+
+static void tst_robin_hood1() {
+    rh_int_set h1;
+    std::unordered_set<int> h2;
+    unsigned n = rand() % 2000;
+    for (unsigned i = 0; i < n; i++) {
+        int v = rand() % 1000;
+        if (rand() % 3 == 2) {
+            h1.erase(v);
+            h2.erase(v);
+            ENSURE(!h1.contains(v));
+        }
+        else {
+            h1.insert(v);
+            h2.insert(v);
+            ENSURE(h1.contains(v));
+        }
+        SASSERT(h1.check_invariant());
+    }
+    for (int v : h2)
+        ENSURE(h1.contains(v));
+    unsigned sz = 0;
+    for (int v : h1) {
+        ENSURE(h2.find(v) != h2.end());
+        sz++;
+    }
+    ENSURE(sz == h1.size());
+    ENSURE(h1.size() == h2.size());
+    rh_int_set h3(h1);
+    ENSURE(h3.size() == h1.size());
+    for (int v : h1)
+        ENSURE(h3.contains(v));
+    h1.reset();
+    ENSURE(h1.empty());
+    for (int v : h2)
+        ENSURE(!h1.contains(v));
+}
+
+struct rh_obj {
+    unsigned m_hash;
+    rh_obj(unsigned h): m_hash(h) {}
+    unsigned hash() const { return m_hash; }
+};
+
+static void tst_robin_hood2() {
+    // many collisions: only 8 distinct hash codes.
+    ptr_vector<rh_obj> objs;
+    for (unsigned i = 0; i < 100; ++i)
+        objs.push_back(alloc(rh_obj, i % 8));
+    obj_map<rh_obj, unsigned, robin_hood_hashtable> m;
+    obj_hashtable<rh_obj, robin_hood_hashtable> s;
+    for (unsigned i = 0; i < objs.size(); ++i) {
+        m.insert(objs[i], i);
+        s.insert(objs[i]);
+    }
+    ENSURE(m.size() == objs.size());
+    for (unsigned i = 0; i < objs.size(); ++i) {
+        ENSURE(m.find(objs[i]) == i);
+        ENSURE(s.contains(objs[i]));
+    }
+    for (unsigned i = 0; i < objs.size(); i += 3) {
+        m.remove(objs[i]);
+        s.remove(objs[i]);
+    }
+    for (unsigned i = 0; i < objs.size(); ++i) {
+        ENSURE(m.contains(objs[i]) == (i % 3 != 0));
+        ENSURE(s.contains(objs[i]) == (i % 3 != 0));
+    }
+    ENSURE(m.insert_if_not_there(objs[0], 42) == 42);
+    ENSURE(m.insert_if_not_there(objs[1], 42) == 1);
+    for (rh_obj * o : objs)
+        dealloc(o);
+}
+
+static int bench_key(unsigned i) {
+    return static_cast<int>(hash_u(i) & 0x3fffffff);
+}
+
+template<typename Set>
+static double bench_churn(unsigned num_rounds, unsigned num_elems, unsigned & checksum) {
+    stopwatch sw;
+    sw.start();
+    Set h;
+    for (unsigned r = 0; r < num_rounds; ++r) {
+        // insert a batch of elements and erase it again, as a scope push/pop does.
+        unsigned base = r * num_elems;
+        for (unsigned i = 0; i < num_elems; ++i)
+            h.insert(bench_key(base + i));
+        for (unsigned i = 0; i < num_elems; ++i)
+            checksum += h.contains(bench_key(base + 2 * i));
+        for (unsigned i = 0; i < num_elems; ++i)
+            h.erase(bench_key(base + i));
+        // keep a few elements alive across rounds.
+        h.insert(bench_key(base));
+    }
+    sw.stop();
+    return sw.get_seconds();
+}
+
+static void tst_robin_hood_bench() {
+    unsigned c1 = 0, c2 = 0;
+    double t_core = bench_churn<core_int_set>(2000, 1000, c1);
+    double t_rh   = bench_churn<rh_int_set>(2000, 1000, c2);
+    ENSURE(c1 == c2);
+    std::cout << "hashtable churn benchmark: core_hashtable " << t_core << "s, robin_hood_hashtable " << t_rh << "s\n";
+}
+
 void tst_hashtable() {
+#ifdef _WINDOWS
     tst3();
     for (int i = 0; i < 100; i++) 
         tst2();
     tst1();
-}
-#else
-void tst_hashtable() {
-}
 #endif
+    for (int i = 0; i < 100; i++) 
+        tst_robin_hood1();
+    tst_robin_hood2();
+    tst_robin_hood_bench();
+}
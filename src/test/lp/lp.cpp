@@ -2210,6 +2210,11 @@ void setup_args_parser(argument_parser & parser) {
     parser.add_option_with_help_string("--test_mpq_np", "test rationals");
     parser.add_option_with_help_string("--test_mpq_np_plus", "test rationals using plus instead of +=");
     parser.add_option_with_help_string("--maximize_term", "test maximize_term()");
+    parser.add_option_with_help_string("--float_first", "compare the rational simplex with and without the float first presolve");
+    parser.add_option_with_help_string("--pivot_int", "test and time the machine integer row update of static_matrix");
+    parser.add_option_with_help_string("--local_bb", "test the local branch-and-bound of int_solver");
+    parser.add_option_with_help_string("--cut_pool", "test the reuse of pooled cuts by int_solver");
+    parser.add_option_with_help_string("--bprop_watches", "test the watches that skip rows unable to imply bounds");
 }
 
 struct fff { int a; int b;};
@@ -3804,6 +3809,297 @@ void test_maximize_term() {
     }
     
 }
+
+lp_status solve_random_lar(unsigned seed, bool float_first, statistics & st) {
+    lar_solver solver;
+    solver.settings().float_first() = float_first;
+    solver.settings().float_first_min_rows = 0;
+    random_gen rand(seed);
+    unsigned num_vars = 40, num_terms = 60;
+    vector<var_index> vars;
+    for (unsigned j = 0; j < num_vars; j++) {
+        var_index v = solver.add_var(j, false);
+        vars.push_back(v);
+        if (rand(2) == 0)
+            solver.add_var_bound(v, GE, mpq(-static_cast<int>(rand(20))));
+        if (rand(2) == 0)
+            solver.add_var_bound(v, LE, mpq(static_cast<int>(rand(20))));
+    }
+    vector<vector<std::pair<mpq, var_index>>> terms;
+    vector<std::pair<lconstraint_kind, mpq>> bounds;
+    for (unsigned i = 0; i < num_terms; i++) {
+        vector<std::pair<mpq, var_index>> ls;
+        for (unsigned k = 0; k < 4; k++)
+            ls.push_back(std::make_pair(mpq(static_cast<int>(rand(19)) - 9, static_cast<int>(rand(3)) + 1), vars[rand(num_vars)]));
+        var_index t = solver.add_term(ls, num_vars + i);
+        lconstraint_kind k = rand(3) == 0 ? GT : (rand(2) == 0 ? GE : LE);
+        mpq rhs(static_cast<int>(rand(41)) - 20 + (k == GT ? -10 : 0));
+        solver.add_var_bound(t, k, rhs);
+        terms.push_back(ls);
+        bounds.push_back(std::make_pair(k, rhs));
+    }
+    lp_status status = solver.find_feasible_solution();
+    if (status == lp_status::OPTIMAL || status == lp_status::FEASIBLE) {
+        std::unordered_map<var_index, mpq> model;
+        solver.get_model(model);
+        for (unsigned i = 0; i < num_terms; i++) {
+            mpq v(0);
+            for (auto const& p : terms[i])
+                v += p.first * model[p.second];
+            switch (bounds[i].first) {
+            case GT: VERIFY(v > bounds[i].second); break;
+            case GE: VERIFY(v >= bounds[i].second); break;
+            default: VERIFY(v <= bounds[i].second); break;
+            }
+        }
+    }
+    st.m_float_first_calls += solver.settings().stats().m_float_first_calls;
+    st.m_float_first_verified += solver.settings().stats().m_float_first_verified;
+    return status;
+}
+
+void test_float_first() {
+    statistics st;
+    unsigned sat = 0;
+    for (unsigned seed = 0; seed < 10; seed++) {
+        lp_status s0 = solve_random_lar(seed, false, st);
+        lp_status s1 = solve_random_lar(seed, true, st);
+        VERIFY((s0 == lp_status::INFEASIBLE) == (s1 == lp_status::INFEASIBLE));
+        if (s0 != lp_status::INFEASIBLE)
+            sat++;
+    }
+    std::cout << "test_float_first: " << sat << " feasible, float first calls " << st.m_float_first_calls
+              << ", verified " << st.m_float_first_verified << std::endl;
+}
+
+void test_local_bb() {
+    for (unsigned threads = 1; threads <= 3; threads++) {
+        lar_solver solver;
+        solver.settings().bb_threads() = threads;
+        solver.settings().bb_period = 1;
+        int_solver lia(solver);
+        vector<var_index> xs;
+        vector<std::pair<mpq, var_index>> ls, ls2;
+        for (unsigned i = 0; i < 3; i++) {
+            xs.push_back(solver.add_var(i, true));
+            solver.add_var_bound(xs[i], GE, mpq(0));
+            solver.add_var_bound(xs[i], LE, mpq(10));
+        }
+        ls.push_back(std::make_pair(mpq(6), xs[0]));
+        ls.push_back(std::make_pair(mpq(10), xs[1]));
+        ls.push_back(std::make_pair(mpq(14), xs[2]));
+        solver.add_var_bound(solver.add_term(ls, 3), EQ, mpq(46));
+        ls2.push_back(std::make_pair(mpq(2), xs[0]));
+        ls2.push_back(std::make_pair(mpq(-3), xs[1]));
+        ls2.push_back(std::make_pair(mpq(1), xs[2]));
+        solver.add_var_bound(solver.add_term(ls2, 4), GE, mpq(1, 2));
+        VERIFY(solver.find_feasible_solution() == lp_status::OPTIMAL || solver.get_status() == lp_status::FEASIBLE);
+        explanation ex;
+        VERIFY(lia.check(&ex) == lia_move::sat);
+        std::unordered_map<var_index, mpq> model;
+        solver.get_model(model);
+        mpq v0 = model[xs[0]], v1 = model[xs[1]], v2 = model[xs[2]];
+        VERIFY(v0.is_int() && v1.is_int() && v2.is_int());
+        VERIFY(mpq(6) * v0 + mpq(10) * v1 + mpq(14) * v2 == mpq(46));
+        VERIFY(mpq(2) * v0 - mpq(3) * v1 + v2 >= mpq(1, 2));
+        std::cout << "test_local_bb: " << threads << " threads, " << solver.settings().stats().m_bb_nodes << " nodes, x = "
+                  << v0 << " " << v1 << " " << v2 << std::endl;
+    }
+}
+
+// repeats int_solver::check on random integer problems without adding the cuts,
+// so the pool sees every cut again and returns the pooled copy
+void test_cut_pool() {
+    statistics st;
+    unsigned cuts = 0;
+    for (unsigned seed = 0; seed < 200; seed++) {
+        lar_solver solver;
+        solver.settings().m_int_gomory_cut_period = 1;
+        solver.settings().m_int_find_cube_period = 1000;
+        solver.settings().enable_hnf() = false;
+        int_solver lia(solver);
+        random_gen rand(seed);
+        unsigned num_vars = 6;
+        vector<var_index> vars;
+        for (unsigned j = 0; j < num_vars; j++) {
+            vars.push_back(solver.add_var(j, true));
+            solver.add_var_bound(vars[j], GE, mpq(0));
+            solver.add_var_bound(vars[j], LE, mpq(20));
+        }
+        for (unsigned i = 0; i < 4; i++) {
+            vector<std::pair<mpq, var_index>> ls;
+            for (unsigned k = 0; k < 3; k++)
+                ls.push_back(std::make_pair(mpq(static_cast<int>(rand(7)) - 3), vars[rand(num_vars)]));
+            var_index t = solver.add_term(ls, num_vars + i);
+            solver.add_var_bound(t, i % 2 == 0 ? GE : LE, mpq(static_cast<int>(rand(21)) - 10, 1));
+        }
+        lp_status status = solver.find_feasible_solution();
+        if (status != lp_status::OPTIMAL && status != lp_status::FEASIBLE)
+            continue;
+        for (unsigned k = 0; k < 5; k++) {
+            explanation ex;
+            if (lia.check(&ex) != lia_move::cut)
+                break;
+            cuts++;
+            VERIFY(lia.current_solution_is_inf_on_cut());
+            for (auto const& ev : ex) {
+                VERIFY(solver.constraints().valid_index(ev.ci()));
+                VERIFY(solver.constraints().is_active(ev.ci()));
+            }
+        }
+        st.m_cut_pool_cuts += solver.settings().stats().m_cut_pool_cuts;
+        st.m_cut_pool_dominated += solver.settings().stats().m_cut_pool_dominated;
+        st.m_cut_pool_reused += solver.settings().stats().m_cut_pool_reused;
+    }
+    std::cout << "test_cut_pool: " << cuts << " cuts returned, " << st.m_cut_pool_cuts << " pooled, "
+              << st.m_cut_pool_dominated << " dominated, " << st.m_cut_pool_reused << " reused" << std::endl;
+    VERIFY(st.m_cut_pool_cuts == 0 || st.m_cut_pool_reused > 0);
+}
+
+// collects the implied bounds of lar_solver::propagate_bounds_for_touched_rows
+struct bprop_test_imp {
+    lar_solver & m_solver;
+    bprop_test_imp(lar_solver & s): m_solver(s) {}
+    lar_solver & lp() { return m_solver; }
+    const lar_solver & lp() const { return m_solver; }
+    bool bound_is_interesting(unsigned, lconstraint_kind, const rational &) const { return true; }
+    void consume(const rational &, constraint_index) {}
+    void add_eq(lpvar, lpvar, const explanation &) {}
+    bool is_equal(unsigned, unsigned) const { return false; }
+};
+
+static unsigned propagate_touched_rows(lar_solver & solver) {
+    bprop_test_imp imp(solver);
+    lp_bound_propagator<bprop_test_imp> bp(imp);
+    bp.init();
+    solver.propagate_bounds_for_touched_rows(bp);
+    return bp.ibounds().size();
+}
+
+void test_bprop_watches() {
+    lar_solver solver;
+    var_index x = solver.add_var(0, false);
+    var_index y = solver.add_var(1, false);
+    var_index z = solver.add_var(2, false);
+    vector<std::pair<mpq, var_index>> ls;
+    ls.push_back(std::make_pair(mpq(1), x));
+    ls.push_back(std::make_pair(mpq(1), y));
+    ls.push_back(std::make_pair(mpq(1), z));
+    var_index s = solver.add_term(ls, 3);
+    solver.add_var_bound(s, LE, mpq(10));
+    solver.find_feasible_solution();
+    // x, y and z are free: the row is skipped without analysis
+    VERIFY(propagate_touched_rows(solver) == 0);
+    VERIFY(solver.settings().stats().m_bprop_inert_rows == 1);
+    solver.add_var_bound(x, GE, mpq(0));
+    solver.add_var_bound(y, GE, mpq(0));
+    solver.find_feasible_solution();
+    // the watches on x and y do not hold anymore, and the rescan finds z alone
+    // unlimited on one side, so the row implies z <= 10
+    VERIFY(propagate_touched_rows(solver) == 1);
+    VERIFY(solver.settings().stats().m_bprop_inert_rows == 1);
+    solver.add_var_bound(z, GE, mpq(0));
+    solver.find_feasible_solution();
+    // now the row implies x, y, z <= 10 and s >= 0
+    VERIFY(propagate_touched_rows(solver) == 4);
+    VERIFY(solver.settings().stats().m_bprop_inert_rows == 1);
+    std::cout << "test_bprop_watches: ok" << std::endl;
+}
+
+static void pivot_on_cell(static_matrix<mpq, numeric_pair<mpq>> & A, unsigned i, unsigned ii, unsigned j) {
+    for (auto & c : A.m_columns[j]) {
+        if (c.var() == ii) {
+            A.pivot_row_to_row_given_cell(i, c, j);
+            return;
+        }
+    }
+    UNREACHABLE();
+}
+
+// eliminates the first columns of a random sparse matrix with coefficients scale * {-3..3}
+static double time_row_eliminations(unsigned seed, mpq const & scale) {
+    random_gen rand(seed);
+    unsigned m = 200, n = 200;
+    static_matrix<mpq, numeric_pair<mpq>> A(m, n);
+    for (unsigned i = 0; i < m; i++) {
+        for (unsigned k = 0; k < 10; k++) {
+            unsigned j = rand(n);
+            int v = static_cast<int>(rand(7)) - 3;
+            if (v != 0 && is_zero(A.get_elem(i, j)))
+                A.set(i, j, scale * mpq(v));
+        }
+    }
+    vector<bool> used(m, false);
+    stopwatch sw;
+    sw.start();
+    for (unsigned p = 0; p < n; p++) {
+        int r = -1;
+        for (auto const & c : A.m_columns[p]) {
+            if (!used[c.var()] && abs(A.get_val(c)) == scale) {
+                r = c.var();
+                break;
+            }
+        }
+        if (r < 0)
+            continue;
+        used[r] = true;
+        A.divide_row(r, A.get_elem(r, p));
+        vector<unsigned> rows;
+        for (auto const & c : A.m_columns[p])
+            if (c.var() != static_cast<unsigned>(r))
+                rows.push_back(c.var());
+        for (unsigned ii : rows)
+            pivot_on_cell(A, r, ii, p);
+    }
+    return sw.get_current_seconds();
+}
+
+void test_pivot_row_to_row_int() {
+    {
+        // integer rows, the update runs in machine integers
+        static_matrix<mpq, numeric_pair<mpq>> A(2, 4);
+        A.set(0, 0, mpq(1)); A.set(0, 1, mpq(3)); A.set(0, 2, mpq(-2));
+        A.set(1, 0, mpq(5)); A.set(1, 2, mpq(7)); A.set(1, 3, mpq(1));
+        pivot_on_cell(A, 0, 1, 0);
+        VERIFY(A.m_rows[1].size() == 3);
+        VERIFY(A.get_elem(1, 1) == mpq(-15));
+        VERIFY(A.get_elem(1, 2) == mpq(17));
+        VERIFY(A.get_elem(1, 3) == mpq(1));
+    }
+    {
+        // cancellation removes the element
+        static_matrix<mpq, numeric_pair<mpq>> A(2, 2);
+        A.set(0, 0, mpq(1)); A.set(0, 1, mpq(1));
+        A.set(1, 0, mpq(1)); A.set(1, 1, mpq(1));
+        pivot_on_cell(A, 0, 1, 0);
+        VERIFY(A.m_rows[1].empty() && A.m_columns[1].size() == 1);
+    }
+    {
+        // the product overflows int64 and the update falls back to rationals
+        mpq big = power(mpq(2), 62);
+        static_matrix<mpq, numeric_pair<mpq>> A(2, 2);
+        A.set(0, 0, mpq(1)); A.set(0, 1, big);
+        A.set(1, 0, mpq(4)); A.set(1, 1, mpq(1));
+        pivot_on_cell(A, 0, 1, 0);
+        VERIFY(A.get_elem(1, 1) == mpq(1) - mpq(4) * big);
+    }
+    {
+        // a fractional coefficient takes the rational path
+        static_matrix<mpq, numeric_pair<mpq>> A(2, 3);
+        A.set(0, 0, mpq(1)); A.set(0, 1, mpq(1, 2));
+        A.set(1, 0, mpq(2)); A.set(1, 2, mpq(3));
+        pivot_on_cell(A, 0, 1, 0);
+        VERIFY(A.get_elem(1, 1) == mpq(-1));
+        VERIFY(A.get_elem(1, 2) == mpq(3));
+    }
+    double t_int = 0, t_rat = 0;
+    for (unsigned seed = 0; seed < 5; seed++) {
+        t_int += time_row_eliminations(seed, mpq(1));
+        t_rat += time_row_eliminations(seed, mpq(1, 2));
+    }
+    std::cout << "row eliminations: integer coefficients " << t_int << "s, fractional coefficients " << t_rat << "s" << std::endl;
+}
+
 #ifdef Z3DEBUG
 void test_hnf() {
     test_larger_generated_hnf();
@@ -4052,6 +4348,36 @@ void test_lp_local(int argn, char**argv) {
         return finalize(ret);
     }
 
+    if (args_parser.option_is_used("--local_bb")) {
+        test_local_bb();
+        ret = 0;
+        return finalize(ret);
+    }
+
+    if (args_parser.option_is_used("--cut_pool")) {
+        test_cut_pool();
+        ret = 0;
+        return finalize(ret);
+    }
+
+    if (args_parser.option_is_used("--bprop_watches")) {
+        test_bprop_watches();
+        ret = 0;
+        return finalize(ret);
+    }
+
+    if (args_parser.option_is_used("--pivot_int")) {
+        test_pivot_row_to_row_int();
+        ret = 0;
+        return finalize(ret);
+    }
+
+    if (args_parser.option_is_used("--float_first")) {
+        test_float_first();
+        ret = 0;
+        return finalize(ret);
+    }
+
     if (args_parser.option_is_used("--maximize_term")) {
         test_maximize_term();
         ret = 0;
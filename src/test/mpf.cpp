@@ -16,6 +16,7 @@ Author:
 Revision History:
 
 --*/
+#include <cstring>
 #include "util/mpf.h"
 #include "util/f2n.h"
 
@@ -81,8 +82,65 @@ static void bug_set_double() {
     ENSURE(fm.to_float(a) == -42.25);
 }
 
+static double random_double(random_gen & r) {
+    static double const specials[] = { 0.0, -0.0, 1.0, -1.0, 1e308, -1e308, 4.9e-324, -2.2e-308, 1.0/0.0, -1.0/0.0 };
+    if (r(8) == 0)
+        return specials[r(sizeof(specials)/sizeof(double))];
+    uint64_t raw = 0;
+    for (unsigned i = 0; i < 4; ++i)
+        raw = (raw << 16) | static_cast<uint64_t>(r(1 << 16));
+    if (r(4) != 0) {
+        // keep most exponents close to the bias so that results stay in range.
+        uint64_t e = 1023 - 30 + r(60);
+        raw = (raw & 0x800FFFFFFFFFFFFFull) | (e << 52);
+    }
+    double d;
+    memcpy(&d, &raw, sizeof(d));
+    return d;
+}
+
+// compare the hardware fast path for double precision against the software implementation.
+static void tst_hwf_fast_path() {
+    mpf_manager hm, sm;
+    sm.set_use_hwf(false);
+    ENSURE(hm.use_hwf());
+    scoped_mpf hx(hm), hy(hm), hz(hm), hr(hm);
+    scoped_mpf sx(sm), sy(sm), sz(sm), sr(sm);
+    scoped_mpz hb(hm.mpz_manager()), sb(sm.mpz_manager());
+    random_gen r(0);
+    mpf_rounding_mode rms[4] = { MPF_ROUND_NEAREST_TEVEN, MPF_ROUND_TOWARD_POSITIVE, MPF_ROUND_TOWARD_NEGATIVE, MPF_ROUND_TOWARD_ZERO };
+    for (unsigned i = 0; i < 2000; ++i) {
+        double x = random_double(r), y = random_double(r), z = random_double(r);
+        mpf_rounding_mode rm = rms[i % 4];
+        hm.set(hx, 11, 53, x); hm.set(hy, 11, 53, y); hm.set(hz, 11, 53, z);
+        sm.set(sx, 11, 53, x); sm.set(sy, 11, 53, y); sm.set(sz, 11, 53, z);
+        for (unsigned op = 0; op < 6; ++op) {
+            switch (op) {
+            case 0: hm.add(rm, hx, hy, hr); sm.add(rm, sx, sy, sr); break;
+            case 1: hm.sub(rm, hx, hy, hr); sm.sub(rm, sx, sy, sr); break;
+            case 2: hm.mul(rm, hx, hy, hr); sm.mul(rm, sx, sy, sr); break;
+            case 3: hm.div(rm, hx, hy, hr); sm.div(rm, sx, sy, sr); break;
+            case 4: hm.fma(rm, hx, hy, hz, hr); sm.fma(rm, sx, sy, sz, sr); break;
+            default: hm.sqrt(rm, hx, hr); sm.sqrt(rm, sx, sr); break;
+            }
+            bool ok = hm.is_nan(hr) || sm.is_nan(sr) ? hm.is_nan(hr) && sm.is_nan(sr) : true;
+            if (ok && !hm.is_nan(hr)) {
+                hm.to_ieee_bv_mpz(hr, hb);
+                sm.to_ieee_bv_mpz(sr, sb);
+                ok = hm.mpz_manager().eq(hb, sb);
+            }
+            if (!ok) {
+                std::cout << "op " << op << " rm " << rm << " " << x << " " << y << " " << z << ": "
+                          << hm.to_string(hr) << " != " << sm.to_string(sr) << "\n";
+                ENSURE(false);
+            }
+        }
+    }
+}
+
 void tst_mpf() {
     enable_trace("mpf_mul_bug");
     bug_set_int();
     bug_set_double();
+    tst_hwf_fast_path();
 }
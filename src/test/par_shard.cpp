@@ -0,0 +1,69 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    par_shard.cpp
+
+Abstract:
+
+    Test and timing of par_shard on goals made of many independent components.
+
+--*/
+
+#include "ast/ast.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/arith_decl_plugin.h"
+#include "util/stopwatch.h"
+#include "tactic/tactical.h"
+#include "tactic/core/propagate_values_tactic.h"
+#include "tactic/core/solve_eqs_tactic.h"
+
+// num_comps chains x_i_0 = i, x_i_(j+1) = x_i_j + 1, x_i_len > y_i
+static void mk_chains(ast_manager & m, unsigned num_comps, unsigned len, goal & g) {
+    arith_util a(m);
+    for (unsigned i = 0; i < num_comps; ++i) {
+        expr_ref prev(m), x(m), y(m);
+        std::string base = "x" + std::to_string(i) + "_";
+        prev = m.mk_const(symbol((base + "0").c_str()), a.mk_int());
+        g.assert_expr(m.mk_eq(prev, a.mk_int(i)));
+        for (unsigned j = 1; j <= len; ++j) {
+            x = m.mk_const(symbol((base + std::to_string(j)).c_str()), a.mk_int());
+            g.assert_expr(m.mk_eq(x, a.mk_add(prev, a.mk_int(1))));
+            prev = x;
+        }
+        y = m.mk_const(symbol(("y" + std::to_string(i)).c_str()), a.mk_int());
+        g.assert_expr(a.mk_gt(prev, y));
+    }
+}
+
+static void tst_par_shard(bool solve_eqs, unsigned num_comps, unsigned len) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    char const * name = solve_eqs ? "solve-eqs" : "propagate-values";
+    tactic * t = solve_eqs ? mk_solve_eqs_tactic(m) : mk_propagate_values_tactic(m);
+    tactic_ref seq = t;
+    tactic_ref par = par_shard(t, 4);
+    goal_ref g1 = alloc(goal, m, false, true, false);
+    goal_ref g2 = alloc(goal, m, false, true, false);
+    mk_chains(m, num_comps, len, *g1);
+    mk_chains(m, num_comps, len, *g2);
+    goal_ref_buffer r1, r2;
+    stopwatch sw1, sw2;
+    sw1.start();
+    (*seq)(g1, r1);
+    sw1.stop();
+    sw2.start();
+    (*par)(g2, r2);
+    sw2.stop();
+    ENSURE(r1.size() == 1 && r2.size() == 1);
+    std::cout << name << " components: " << num_comps << " formulas: " << g2->size()
+              << " sequential: " << sw1.get_seconds() << "s sharded: " << sw2.get_seconds() << "s"
+              << " result: " << r1[0]->size() << " / " << r2[0]->size() << "\n";
+    ENSURE(r1[0]->size() == r2[0]->size());
+}
+
+void tst_par_shard() {
+    tst_par_shard(false, 2000, 10);
+    tst_par_shard(true, 2000, 10);
+}
@@ -1,3 +1,8 @@
+#ifndef SINGLE_THREAD
+#include <thread>
+#endif
+#include <vector>
+#include "util/scoped_ptr_vector.h"
 #include "math/dd/dd_pdd.h"
 
 namespace dd {
@@ -284,6 +289,40 @@ public :
         
     }
 
+    static void translate() {
+        std::cout << "\ntranslate\n";
+        pdd_manager m(4);
+        pdd a = m.mk_var(0);
+        pdd b = m.mk_var(1);
+        pdd c = m.mk_var(2);
+        pdd p = (a + b*c + 3) * (a*a - c);
+        pdd_manager m1(4);
+        pdd q = m1.translate(p);
+        std::cout << p << " -> " << q << "\n";
+        VERIFY(m.translate(q) == p);
+        VERIFY(m.translate(q * q) == p * p);
+#ifndef SINGLE_THREAD
+        // each manager is used by one thread, and the results are translated after the threads are joined
+        unsigned n = 3;
+        scoped_ptr_vector<pdd_manager> ms;
+        std::vector<pdd> qs;
+        for (unsigned i = 0; i < n; ++i) {
+            ms.push_back(alloc(pdd_manager, 4));
+            qs.push_back(ms[i]->translate(p));
+        }
+        std::vector<std::thread> threads;
+        for (unsigned i = 0; i < n; ++i) 
+            threads.push_back(std::thread([&, i]() { for (unsigned k = 0; k <= i; ++k) qs[i] = qs[i] * qs[i]; }));
+        for (auto& t : threads)
+            t.join();
+        pdd r = p;
+        for (unsigned i = 0; i < n; ++i) {
+            r = r * r;
+            VERIFY(m.translate(qs[i]) == r);
+        }
+#endif
+    }
+
 };
 
 }
@@ -297,4 +336,5 @@ void tst_pdd() {
     dd::test::iterator();
     dd::test::order();
     dd::test::order_lm();
+    dd::test::translate();
 }
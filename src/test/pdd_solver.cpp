@@ -228,6 +228,36 @@ namespace dd {
         g.display(std::cout);
     }
 
+    /**
+     * a saturated basis is extended with new equations instead of starting over
+     */
+    void test_extend() {
+        pdd_manager m(4);
+        reslimit lim;
+        pdd v1 = m.mk_var(1);
+        pdd v2 = m.mk_var(2);
+        pdd v3 = m.mk_var(3);
+
+        solver gb(lim, m);
+        gb.add(v1*v2 + v1*v3);
+        gb.add(v1 - 1);
+        gb.saturate();
+        gb.display(std::cout << "basis\n");
+        for (auto* e : gb.equations())
+            VERIFY(!e->poly().is_val());
+
+        gb.reopen_solved();
+        gb.add(v2 + v3 + 1);
+        gb.adjust_cfg();
+        gb.saturate();
+        gb.display(std::cout << "extended basis\n");
+        bool found = false;
+        for (auto* e : gb.equations())
+            found |= e->poly().is_val() && !e->poly().is_zero();
+        VERIFY(found);
+        gb.reset();
+    }
+
     void test2() {
         ast_manager m;
         reg_decl_plugins(m);
@@ -256,5 +286,6 @@ namespace dd {
 
 void tst_pdd_solver() {
     dd::test1();
+    dd::test_extend();
     dd::test2();
 }
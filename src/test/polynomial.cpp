@@ -1421,6 +1421,39 @@ static void tst_mk_unique() {
     ENSURE(p.get() == q.get());
 }
 
+static void tst_psc_cache() {
+    polynomial::numeral_manager nm;
+    reslimit rl; polynomial::manager m(rl, nm);
+    polynomial_ref x0(m);
+    polynomial_ref x1(m);
+    x0 = m.mk_polynomial(m.mk_var());
+    x1 = m.mk_polynomial(m.mk_var());
+    polynomial::cache c(m);
+    c.set_max_entries(1);
+    polynomial_ref p(m), q(m), r(m);
+    p = (x1^2) + x0*x1 - 2;
+    q = (x1^2) - x0;
+    r = (x1^3) + x0;
+    polynomial_ref_vector S1(m), S2(m), S3(m);
+    c.psc_chain(p, q, 1, S1);
+    c.psc_chain(p, q, 1, S2);
+    m.psc_chain(p, q, 1, S3);
+    ENSURE(S1.size() == S3.size() && S2.size() == S3.size());
+    for (unsigned i = 0; i < S3.size(); i++) {
+        ENSURE(S1.get(i) == S2.get(i));
+        ENSURE(m.eq(S1.get(i), S3.get(i)));
+    }
+    // the limit of one entry drops the chain of p and q
+    c.psc_chain(p, r, 1, S2);
+    c.psc_chain(p, q, 1, S2);
+    ENSURE(S2.size() == S3.size());
+    for (unsigned i = 0; i < S3.size(); i++)
+        ENSURE(m.eq(S2.get(i), S3.get(i)));
+    statistics st;
+    c.collect_statistics(st);
+    st.display(std::cout);
+}
+
 struct dummy_del_eh : public polynomial::manager::del_eh {
     unsigned m_counter;
     dummy_del_eh():m_counter(0) {}
@@ -1822,6 +1855,7 @@ void tst_polynomial() {
     // enable_trace("eval_bug");
     // enable_trace("mgcd");
     tst_psc();
+    tst_psc_cache();
     return;
     tst_eval();
     tst_divides();
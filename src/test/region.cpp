@@ -17,13 +17,61 @@ Revision History:
 
 --*/
 #include<stdlib.h>
+#include<sstream>
+#include<cstring>
+#include<climits>
 #include "util/region.h"
+#include "util/debug.h"
 
 static void tst1() {
-    // TODO
+    region r;
+    r.push_scope();
+    unsigned * a = new (r) unsigned[4];
+    for (unsigned i = 0; i < 4; ++i) a[i] = i;
+    r.deallocate(4 * sizeof(unsigned), a);
+    unsigned * b = new (r) unsigned[4];
+    for (unsigned i = 0; i < 4; ++i) b[i] = 10 + i;
+    // a big object does not go through the size class free lists.
+    char * c = static_cast<char*>(r.allocate(1024));
+    memset(c, 0, 1024);
+    r.deallocate(1024, c);
+    r.push_scope();
+    for (unsigned i = 0; i < 10000; ++i) {
+        unsigned * d = new (r) unsigned[2];
+        d[0] = d[1] = i;
+        if (i % 2 == 0)
+            r.deallocate(2 * sizeof(unsigned), d);
+    }
+    r.pop_scope();
+    for (unsigned i = 0; i < 4; ++i) ENSURE(b[i] == 10 + i);
+    r.pop_scope();
+    r.reset();
+    std::ostringstream out;
+    r.display_mem_stats(out);
+    ENSURE(!out.str().empty());
+}
+
+static void tst2() {
+    unsigned n = memory::get_num_subsystems();
+    {
+        region r("tst_region");
+        for (unsigned i = 0; i < 100; ++i)
+            r.allocate(100);
+        unsigned idx = UINT_MAX;
+        for (unsigned i = 0; i < memory::get_num_subsystems(); ++i)
+            if (strcmp(memory::get_subsystem_id(i), "tst_region") == 0)
+                idx = i;
+        ENSURE(idx != UINT_MAX);
+        ENSURE(memory::get_subsystem_usage(idx) >= 100*100);
+    }
+    ENSURE(memory::get_num_subsystems() >= n);
+    for (unsigned i = 0; i < memory::get_num_subsystems(); ++i)
+        if (strcmp(memory::get_subsystem_id(i), "tst_region") == 0)
+            ENSURE(memory::get_subsystem_usage(i) == 0);
 }
 
 void tst_region() {
     tst1();
+    tst2();
 }
 
@@ -151,7 +151,7 @@ public:
     
     unsigned hash(hwf const & a) { return hash_ull(a.get_raw()); }
 
-    inline void set_rounding_mode(mpf_rounding_mode rm);
+    void set_rounding_mode(mpf_rounding_mode rm);
 
     /**
        \brief Return the biggest k s.t. 2^k <= a.
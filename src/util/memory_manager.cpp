@@ -7,6 +7,7 @@ Copyright (c) 2015 Microsoft Corporation
 #include<iostream>
 #include<stdlib.h>
 #include<climits>
+#include<cstring>
 #include "util/mutex.h"
 #include "util/trace.h"
 #include "util/memory_manager.h"
@@ -183,11 +184,76 @@ unsigned long long memory::get_allocation_count() {
 }
 
 
+#define MAX_NUM_SUBSYSTEMS 64
+
+struct subsystem_usage {
+    char const * m_id;
+    long long    m_size;
+    long long    m_max_size;
+};
+
+static subsystem_usage g_subsystem_usage[MAX_NUM_SUBSYSTEMS];
+static unsigned        g_num_subsystems = 0;
+
+void memory::update_subsystem_usage(char const * id, long long delta) {
+    if (id == nullptr || delta == 0)
+        return;
+    lock_guard lock(*g_memory_mux);
+    unsigned i = 0;
+    for (; i < g_num_subsystems; ++i) {
+        if (g_subsystem_usage[i].m_id == id || strcmp(g_subsystem_usage[i].m_id, id) == 0)
+            break;
+    }
+    if (i == g_num_subsystems) {
+        if (g_num_subsystems == MAX_NUM_SUBSYSTEMS)
+            return;
+        g_subsystem_usage[i].m_id       = id;
+        g_subsystem_usage[i].m_size     = 0;
+        g_subsystem_usage[i].m_max_size = 0;
+        g_num_subsystems++;
+    }
+    subsystem_usage & u = g_subsystem_usage[i];
+    u.m_size += delta;
+    if (u.m_size > u.m_max_size)
+        u.m_max_size = u.m_size;
+}
+
+unsigned memory::get_num_subsystems() {
+    return g_num_subsystems;
+}
+
+char const * memory::get_subsystem_id(unsigned idx) {
+    SASSERT(idx < g_num_subsystems);
+    return g_subsystem_usage[idx].m_id;
+}
+
+unsigned long long memory::get_subsystem_usage(unsigned idx) {
+    SASSERT(idx < g_num_subsystems);
+    lock_guard lock(*g_memory_mux);
+    return static_cast<unsigned long long>(g_subsystem_usage[idx].m_size);
+}
+
+unsigned long long memory::get_subsystem_max_usage(unsigned idx) {
+    SASSERT(idx < g_num_subsystems);
+    lock_guard lock(*g_memory_mux);
+    return static_cast<unsigned long long>(g_subsystem_usage[idx].m_max_size);
+}
+
+void memory::display_subsystem_usage(std::ostream & os) {
+    unsigned n = get_num_subsystems();
+    for (unsigned i = 0; i < n; ++i) {
+        os << "  " << get_subsystem_id(i) << ": "
+           << static_cast<double>(get_subsystem_usage(i))/static_cast<double>(1024*1024) << " Mbytes (max. "
+           << static_cast<double>(get_subsystem_max_usage(i))/static_cast<double>(1024*1024) << " Mbytes)\n";
+    }
+}
+
 void memory::display_max_usage(std::ostream & os) {
     unsigned long long mem = get_max_used_memory();
     os << "max. heap size:     " 
        << static_cast<double>(mem)/static_cast<double>(1024*1024) 
        << " Mbytes\n";
+    display_subsystem_usage(os);
 }
 
 void memory::display_i_max_usage(std::ostream & os) {
@@ -68,6 +68,14 @@ public:
     static unsigned long long get_max_used_memory();
     static unsigned long long get_allocation_count();
     static unsigned long long get_max_memory_size();
+    // Per subsystem accounting of memory held by allocators (region, small_object_allocator).
+    // It is only updated when allocators acquire/release whole pages/chunks.
+    static void update_subsystem_usage(char const * id, long long delta);
+    static unsigned get_num_subsystems();
+    static char const * get_subsystem_id(unsigned idx);
+    static unsigned long long get_subsystem_usage(unsigned idx);
+    static unsigned long long get_subsystem_max_usage(unsigned idx);
+    static void display_subsystem_usage(std::ostream& os);
     // temporary hack to avoid out-of-memory crash in z3.exe
     static void exit_when_out_of_memory(bool flag, char const * msg);
 };
@@ -20,6 +20,7 @@ Revision History:
 #include<sstream>
 #include<iomanip>
 #include "util/mpf.h"
+#include "util/hwf.h"
 
 mpf::mpf() :
     ebits(0),
@@ -61,10 +62,30 @@ void mpf::swap(mpf & other) {
 
 mpf_manager::mpf_manager() :
     m_mpz_manager(m_mpq_manager),
+    m_hwf_manager(alloc(hwf_manager)),
+    m_use_hwf(true),
     m_powers2(m_mpz_manager) {
 }
 
 mpf_manager::~mpf_manager() {
+    dealloc(m_hwf_manager);
+}
+
+/**
+   \brief Double precision operations in a rounding mode supported by the
+   hardware produce the correctly rounded result natively, so there is no
+   need to go through the multi-precision significand.
+*/
+bool mpf_manager::use_hwf(mpf_rounding_mode rm, mpf const & x) const {
+    return m_use_hwf && x.ebits == 11 && x.sbits == 53 && rm != MPF_ROUND_NEAREST_TAWAY;
+}
+
+void mpf_manager::set_hwf_result(double v, mpf & o) {
+    // Leave the FPU in its default mode for other users of doubles.
+    m_hwf_manager->set_rounding_mode(MPF_ROUND_NEAREST_TEVEN);
+    set(o, 11, 53, v);
+    if (is_nan(o))
+        mk_nan(11, 53, o);
 }
 
 void mpf_manager::set(mpf & o, unsigned ebits, unsigned sbits, int value) {
@@ -479,7 +500,17 @@ void mpf_manager::add_sub(mpf_rounding_mode rm, mpf const & x, mpf const & y, mp
 
     bool sgn_y = sgn(y) ^ sub;
 
-    if (is_nan(x))
+    if (use_hwf(rm, x)) {
+        scoped_hwf a(*m_hwf_manager), b(*m_hwf_manager), r(*m_hwf_manager);
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->set(b, to_double(y));
+        if (sub)
+            m_hwf_manager->sub(rm, a, b, r);
+        else
+            m_hwf_manager->add(rm, a, b, r);
+        set_hwf_result(m_hwf_manager->to_double(r), o);
+    }
+    else if (is_nan(x))
         mk_nan(x.ebits, x.sbits, o);
     else if (is_nan(y))
         mk_nan(x.ebits, x.sbits, o);
@@ -594,7 +625,14 @@ void mpf_manager::mul(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf &
     TRACE("mpf_dbg", tout << "X = " << to_string(x) << std::endl;);
     TRACE("mpf_dbg", tout << "Y = " << to_string(y) << std::endl;);
 
-    if (is_nan(x))
+    if (use_hwf(rm, x)) {
+        scoped_hwf a(*m_hwf_manager), b(*m_hwf_manager), r(*m_hwf_manager);
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->set(b, to_double(y));
+        m_hwf_manager->mul(rm, a, b, r);
+        set_hwf_result(m_hwf_manager->to_double(r), o);
+    }
+    else if (is_nan(x))
         mk_nan(x.ebits, x.sbits, o);
     else if (is_nan(y))
         mk_nan(x.ebits, x.sbits, o);
@@ -669,7 +707,14 @@ void mpf_manager::div(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf &
     TRACE("mpf_dbg", tout << "X = " << to_string(x) << std::endl;);
     TRACE("mpf_dbg", tout << "Y = " << to_string(y) << std::endl;);
 
-    if (is_nan(x))
+    if (use_hwf(rm, x)) {
+        scoped_hwf a(*m_hwf_manager), b(*m_hwf_manager), r(*m_hwf_manager);
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->set(b, to_double(y));
+        m_hwf_manager->div(rm, a, b, r);
+        set_hwf_result(m_hwf_manager->to_double(r), o);
+    }
+    else if (is_nan(x))
         mk_nan(x.ebits, x.sbits, o);
     else if (is_nan(y))
         mk_nan(x.ebits, x.sbits, o);
@@ -752,7 +797,15 @@ void mpf_manager::fma(mpf_rounding_mode rm, mpf const & x, mpf const & y, mpf co
     TRACE("mpf_dbg", tout << "Y = " << to_string(y) << std::endl;);
     TRACE("mpf_dbg", tout << "Z = " << to_string(z) << std::endl;);
 
-    if (is_nan(x) || is_nan(y) || is_nan(z))
+    if (use_hwf(rm, x)) {
+        scoped_hwf a(*m_hwf_manager), b(*m_hwf_manager), c(*m_hwf_manager), r(*m_hwf_manager);
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->set(b, to_double(y));
+        m_hwf_manager->set(c, to_double(z));
+        m_hwf_manager->fma(rm, a, b, c, r);
+        set_hwf_result(m_hwf_manager->to_double(r), o);
+    }
+    else if (is_nan(x) || is_nan(y) || is_nan(z))
         mk_nan(x.ebits, x.sbits, o);
     else if (is_pinf(x)) {
         if (is_zero(y))
@@ -1006,7 +1059,13 @@ void mpf_manager::sqrt(mpf_rounding_mode rm, mpf const & x, mpf & o) {
 
     TRACE("mpf_dbg", tout << "X = " << to_string(x) << std::endl;);
 
-    if (is_nan(x))
+    if (use_hwf(rm, x)) {
+        scoped_hwf a(*m_hwf_manager), r(*m_hwf_manager);
+        m_hwf_manager->set(a, to_double(x));
+        m_hwf_manager->sqrt(rm, a, r);
+        set_hwf_result(m_hwf_manager->to_double(r), o);
+    }
+    else if (is_nan(x))
         mk_nan(x.ebits, x.sbits, o);
     else if (is_pinf(x))
         set(o, x);
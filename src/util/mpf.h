@@ -36,6 +36,8 @@ typedef enum {
 
 typedef int64_t mpf_exp_t;
 
+class hwf_manager;
+
 class mpf {
     friend class mpf_manager;
     friend class scoped_mpf;
@@ -59,6 +61,8 @@ public:
 class mpf_manager {
     unsynch_mpq_manager m_mpq_manager;
     unsynch_mpz_manager & m_mpz_manager; // A mpq_manager is a mpz_manager, reusing it.
+    hwf_manager * m_hwf_manager;
+    bool          m_use_hwf;
 
 public:
     typedef mpf numeral;
@@ -211,6 +215,13 @@ public:
     void to_sbv_mpq(mpf_rounding_mode rm, const mpf & x, scoped_mpq & o);
     void to_ieee_bv_mpz(const mpf & x, scoped_mpz & o);
 
+    /**
+       \brief Enable/disable evaluation of double precision add, sub, mul, div,
+       fma and sqrt on the hardware FPU (enabled by default).
+    */
+    void set_use_hwf(bool f) { m_use_hwf = f; }
+    bool use_hwf() const { return m_use_hwf; }
+
 protected:
     void mk_one(unsigned ebits, unsigned sbits, bool sign, mpf & o) const;
 
@@ -227,6 +238,9 @@ protected:
 
     void mk_round_inf(mpf_rounding_mode rm, mpf & o);
 
+    bool use_hwf(mpf_rounding_mode rm, mpf const & x) const;
+    void set_hwf_result(double v, mpf & o);
+
     // Convert x into a mpz numeral. zm is the manager that owns o.
     void to_mpz(mpf const & x, unsynch_mpz_manager & zm, mpz & o);
     void to_mpz(mpf const & x, scoped_mpz & o) { to_mpz(x, o.m(), o); }
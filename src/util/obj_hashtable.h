@@ -20,6 +20,7 @@ Revision History:
 
 #include "util/hash.h"
 #include "util/hashtable.h"
+#include "util/robin_hood_hashtable.h"
 
 
 /**
@@ -45,15 +46,19 @@ public:
     void mark_as_free() { m_ptr = nullptr; }
 };
 
-template<typename T>
-class obj_hashtable : public core_hashtable<obj_hash_entry<T>, obj_ptr_hash<T>, ptr_eq<T> > {
+/**
+   \brief Hashtable of obj pointers. The template parameter Table selects the underlying
+   hashtable implementation: core_hashtable or robin_hood_hashtable.
+*/
+template<typename T, template<typename, typename, typename> class Table = core_hashtable>
+class obj_hashtable : public Table<obj_hash_entry<T>, obj_ptr_hash<T>, ptr_eq<T> > {
 public:
     obj_hashtable(unsigned initial_capacity = DEFAULT_HASHTABLE_INITIAL_CAPACITY):
-        core_hashtable<obj_hash_entry<T>, obj_ptr_hash<T>, ptr_eq<T> >(initial_capacity) {}
+        Table<obj_hash_entry<T>, obj_ptr_hash<T>, ptr_eq<T> >(initial_capacity) {}
 
 };
 
-template<typename Key, typename Value>
+template<typename Key, typename Value, template<typename, typename, typename> class Table = core_hashtable>
 class obj_map {
 public:
     struct key_data {
@@ -95,7 +100,7 @@ public:
         void mark_as_free() { m_data.m_key = nullptr; }
     };
 
-    typedef core_hashtable<obj_map_entry, obj_hash<key_data>, default_eq<key_data> > table;
+    typedef Table<obj_map_entry, obj_hash<key_data>, default_eq<key_data> > table;
 
     table m_table;
   
@@ -0,0 +1,152 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    phase_profiler.cpp
+
+Abstract:
+
+    Hierarchical phase profiler.
+
+--*/
+#include<string>
+#include<iomanip>
+#include "util/phase_profiler.h"
+#include "util/memory_manager.h"
+#include "util/statistics.h"
+#include "util/mutex.h"
+#include "util/vector.h"
+
+namespace {
+    struct phase_record {
+        std::string        m_path;
+        std::string        m_time_key;
+        std::string        m_memory_key;
+        std::string        m_max_memory_key;
+        std::string        m_count_key;
+        double             m_seconds;
+        long long          m_memory;
+        unsigned long long m_max_memory;
+        unsigned           m_count;
+        phase_record(std::string const & path):
+            m_path(path),
+            m_time_key("phase " + path + " time"),
+            m_memory_key("phase " + path + " memory"),
+            m_max_memory_key("phase " + path + " max memory"),
+            m_count_key("phase " + path + " count") {
+            reset();
+        }
+        void reset() {
+            m_seconds    = 0;
+            m_memory     = 0;
+            m_max_memory = 0;
+            m_count      = 0;
+        }
+    };
+}
+
+static bool                      g_phase_profile_enabled = false;
+static DECLARE_INIT_MUTEX(g_phase_mux);
+// records are only deleted by finalize since statistics objects keep pointers to their keys.
+static ptr_vector<phase_record> * g_phase_records = nullptr;
+static thread_local std::string   g_phase_path;
+
+static double to_mb(long long sz) {
+    return static_cast<double>(sz) / static_cast<double>(1024*1024);
+}
+
+void phase_profiler::enable(bool flag) {
+    g_phase_profile_enabled = flag;
+}
+
+bool phase_profiler::enabled() {
+    return g_phase_profile_enabled;
+}
+
+void phase_profiler::reset() {
+    lock_guard lock(*g_phase_mux);
+    if (g_phase_records)
+        for (phase_record * r : *g_phase_records)
+            r->reset();
+}
+
+void phase_profiler::collect_statistics(statistics & st) {
+    lock_guard lock(*g_phase_mux);
+    if (!g_phase_records)
+        return;
+    for (phase_record * r : *g_phase_records) {
+        st.update(r->m_time_key.c_str(), r->m_seconds);
+        st.update(r->m_memory_key.c_str(), to_mb(r->m_memory));
+        st.update(r->m_max_memory_key.c_str(), to_mb(r->m_max_memory));
+        st.update(r->m_count_key.c_str(), r->m_count);
+    }
+}
+
+void phase_profiler::display(std::ostream & out) {
+    lock_guard lock(*g_phase_mux);
+    if (!g_phase_records)
+        return;
+    for (phase_record * r : *g_phase_records) {
+        if (r->m_count == 0)
+            continue;
+        out << "(phase " << r->m_path
+            << " :count " << r->m_count
+            << " :time " << std::fixed << std::setprecision(2) << r->m_seconds
+            << " :memory " << std::fixed << std::setprecision(2) << to_mb(r->m_memory)
+            << " :max-memory " << std::fixed << std::setprecision(2) << to_mb(r->m_max_memory) << ")\n";
+    }
+}
+
+void phase_profiler::finalize() {
+    if (g_phase_records) {
+        std::for_each(g_phase_records->begin(), g_phase_records->end(), delete_proc<phase_record>());
+        dealloc(g_phase_records);
+        g_phase_records = nullptr;
+    }
+}
+
+scoped_phase::scoped_phase(char const * name):
+    m_active(g_phase_profile_enabled) {
+    if (!m_active)
+        return;
+    m_old_path_len = g_phase_path.size();
+    if (m_old_path_len > 0)
+        g_phase_path += "/";
+    g_phase_path += name;
+    m_start_memory     = memory::get_allocation_size();
+    m_start_max_memory = memory::get_max_used_memory();
+    m_watch.start();
+}
+
+scoped_phase::~scoped_phase() {
+    if (!m_active)
+        return;
+    m_watch.stop();
+    unsigned long long end_memory     = memory::get_allocation_size();
+    unsigned long long end_max_memory = memory::get_max_used_memory();
+    // If the phase raised the global peak, then it reached the new peak.
+    // Otherwise, the peak of the phase is approximated by its memory usage at the boundaries.
+    unsigned long long max_memory = end_max_memory > m_start_max_memory ? end_max_memory : std::max(m_start_memory, end_memory);
+    {
+        lock_guard lock(*g_phase_mux);
+        if (!g_phase_records)
+            g_phase_records = alloc(ptr_vector<phase_record>);
+        phase_record * rec = nullptr;
+        for (phase_record * r : *g_phase_records) {
+            if (r->m_path == g_phase_path) {
+                rec = r;
+                break;
+            }
+        }
+        if (!rec) {
+            rec = alloc(phase_record, g_phase_path);
+            g_phase_records->push_back(rec);
+        }
+        rec->m_seconds += m_watch.get_seconds();
+        rec->m_memory  += static_cast<long long>(end_memory) - static_cast<long long>(m_start_memory);
+        rec->m_max_memory = std::max(rec->m_max_memory, max_memory);
+        rec->m_count++;
+    }
+    g_phase_path.resize(m_old_path_len);
+}
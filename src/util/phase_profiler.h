@@ -0,0 +1,54 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    phase_profiler.h
+
+Abstract:
+
+    Hierarchical phase profiler.
+
+    A scoped_phase records wall time and memory usage of a named phase.
+    Phases nest: a phase "search" started inside the phase "smt" is
+    recorded as "smt/search". The profiler is disabled by default
+    (see the global parameter phase_profile), and a disabled scoped_phase
+    costs a single test.
+
+    ADD_FINALIZER('phase_profiler::finalize();')
+
+--*/
+#pragma once
+
+#include<ostream>
+#include "util/stopwatch.h"
+
+class statistics;
+
+class phase_profiler {
+public:
+    static void enable(bool flag);
+    static bool enabled();
+    /**
+       \brief Reset the values of all phases recorded so far.
+    */
+    static void reset();
+    /**
+       \brief Add entries "phase <path> time", "phase <path> memory" (net allocated megabytes),
+       "phase <path> max memory" (megabytes) and "phase <path> count" for every recorded phase.
+    */
+    static void collect_statistics(statistics & st);
+    static void display(std::ostream & out);
+    static void finalize();
+};
+
+class scoped_phase {
+    bool               m_active;
+    size_t             m_old_path_len;
+    stopwatch          m_watch;
+    unsigned long long m_start_memory;
+    unsigned long long m_start_max_memory;
+public:
+    scoped_phase(char const * name);
+    ~scoped_phase();
+};
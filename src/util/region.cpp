@@ -22,6 +22,9 @@ Revision History:
 
 void region::display_mem_stats(std::ostream & out) const {
     out << "num. objects:      " << m_chuncks.size() << "\n";
+    out << "allocated bytes:   " << m_alloc_size << "\n";
+    out << "max. bytes:        " << m_max_alloc_size << "\n";
+    out << "num. popped scopes:" << m_num_scopes_popped << "\n";
 }
 
 #else
@@ -32,26 +35,58 @@ void region::display_mem_stats(std::ostream & out) const {
 #include "util/page.h"
 
 inline void region::allocate_page() {
+    if (m_free_pages == nullptr) {
+        m_num_owned_pages++;
+        memory::update_subsystem_usage(m_id, DEFAULT_PAGE_SIZE);
+    }
     m_curr_page     = allocate_default_page(m_curr_page, m_free_pages);
     m_curr_ptr      = m_curr_page;
     m_curr_end_ptr  = end_of_default_page(m_curr_page);
+    m_num_pages++;
+    if (m_num_pages > m_max_num_pages)
+        m_max_num_pages = m_num_pages;
 }
 
-region::region() {
+region::region(char const * id) {
     m_curr_page    = nullptr;
     m_curr_ptr     = nullptr;
     m_curr_end_ptr = nullptr;
     m_free_pages   = nullptr;
     m_mark         = nullptr;
+    m_id           = id;
+    m_num_free     = 0;
+    for (unsigned i = 0; i < NUM_SIZE_CLASSES; i++)
+        m_free_list[i] = nullptr;
+    m_num_pages          = 0;
+    m_max_num_pages      = 0;
+    m_num_owned_pages    = 0;
+    m_num_scopes_popped  = 0;
+    m_num_released_pages = 0;
+    m_num_reused         = 0;
     allocate_page();
 }
 
 region::~region() {
     del_pages(m_curr_page);
     del_pages(m_free_pages);
+    memory::update_subsystem_usage(m_id, -static_cast<long long>(m_num_owned_pages) * DEFAULT_PAGE_SIZE);
+}
+
+inline unsigned region::get_size_class(size_t size) {
+    return static_cast<unsigned>((size + ALIGNMENT_VALUE - 1) >> PTR_ALIGNMENT);
 }
 
 void * region::allocate(size_t size) {
+    if (m_num_free > 0) {
+        unsigned sc = get_size_class(size);
+        if (sc < NUM_SIZE_CLASSES && m_free_list[sc] != nullptr) {
+            void * r = m_free_list[sc];
+            m_free_list[sc] = *(reinterpret_cast<void **>(r));
+            m_num_free--;
+            m_num_reused++;
+            return r;
+        }
+    }
     char * new_curr_ptr = m_curr_ptr + size;
     if (new_curr_ptr < m_curr_end_ptr) {
         char * result = m_curr_ptr;
@@ -74,13 +109,35 @@ void * region::allocate(size_t size) {
     }
 }
 
+void region::deallocate(size_t size, void * p) {
+    if (p == nullptr || size == 0)
+        return;
+    unsigned sc = get_size_class(size);
+    if (sc >= NUM_SIZE_CLASSES)
+        return;
+    *(reinterpret_cast<void **>(p)) = m_free_list[sc];
+    m_free_list[sc] = p;
+    m_num_free++;
+}
+
+inline void region::reset_free_lists() {
+    if (m_num_free == 0)
+        return;
+    for (unsigned i = 0; i < NUM_SIZE_CLASSES; i++)
+        m_free_list[i] = nullptr;
+    m_num_free = 0;
+}
+
 inline void region::recycle_curr_page() {
     char * prev = prev_page(m_curr_page);
+    if (is_default_page(m_curr_page))
+        m_num_pages--;
     recycle_page(m_curr_page, m_free_pages);
     m_curr_page = prev;
 }
 
 void region::reset() {
+    reset_free_lists();
     while (m_curr_page != nullptr) {
         recycle_curr_page();
     }
@@ -99,26 +156,28 @@ void region::push_scope() {
 
 void region::pop_scope() {
     SASSERT(m_mark);
+    reset_free_lists();
     char * old_curr_page = m_mark->m_curr_page;
     SASSERT(is_default_page(old_curr_page));
     m_curr_ptr           = m_mark->m_curr_ptr;
     m_mark               = m_mark->m_prev_mark;
+    unsigned num_pages   = m_num_pages;
     while (m_curr_page != old_curr_page) {
         recycle_curr_page();
     }
+    m_num_released_pages += num_pages - m_num_pages;
+    m_num_scopes_popped++;
     SASSERT(is_default_page(m_curr_page));
     m_curr_end_ptr       = end_of_default_page(m_curr_page);
 }
 
 void region::display_mem_stats(std::ostream & out) const {
-    unsigned n = 0;
-    char * page = m_curr_page;
-    while (page != nullptr) {
-        n++;
-        page = prev_page(page);
-    }
-    out << "num. pages:      " << n << "\n";
+    out << "num. pages:      " << m_num_pages << "\n";
+    out << "max. num. pages: " << m_max_num_pages << "\n";
+    out << "owned pages:     " << m_num_owned_pages << "\n";
+    out << "popped scopes:   " << m_num_scopes_popped << "\n";
+    out << "released pages:  " << m_num_released_pages << "\n";
+    out << "reused objects:  " << m_num_reused << "\n";
 }
 
 #endif
-
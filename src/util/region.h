@@ -20,14 +20,35 @@ Revision History:
 #include<cstdlib>
 #include<iostream>
 
+#include "util/memory_manager.h"
+
 #ifdef Z3DEBUG
 
 #include "util/vector.h"
 
 class region {
     ptr_vector<char> m_chuncks;
+    svector<size_t>  m_sizes;
     unsigned_vector  m_scopes;
+    char const *     m_id;
+    size_t           m_alloc_size;
+    size_t           m_max_alloc_size;
+    unsigned         m_num_scopes_popped;
+
+    void del_chuncks(unsigned old_size) {
+        size_t sz = 0;
+        for (unsigned i = old_size; i < m_chuncks.size(); ++i) {
+            dealloc_svect(m_chuncks[i]);
+            sz += m_sizes[i];
+        }
+        m_chuncks.shrink(old_size);
+        m_sizes.shrink(old_size);
+        m_alloc_size -= sz;
+        memory::update_subsystem_usage(m_id, -static_cast<long long>(sz));
+    }
 public:
+    region(char const * id = "region"):m_id(id), m_alloc_size(0), m_max_alloc_size(0), m_num_scopes_popped(0) {}
+
     ~region() {
         reset();
     }
@@ -35,16 +56,21 @@ public:
     void * allocate(size_t size) {
         char * r = alloc_svect(char, size);
         m_chuncks.push_back(r);
+        m_sizes.push_back(size);
+        m_alloc_size += size;
+        if (m_alloc_size > m_max_alloc_size)
+            m_max_alloc_size = m_alloc_size;
+        memory::update_subsystem_usage(m_id, static_cast<long long>(size));
         return r;
     }
 
+    /**
+       \brief In debug mode, objects are never reused. So, they are released by pop_scope/reset.
+    */
+    void deallocate(size_t, void *) {}
+
     void reset() {
-        ptr_vector<char>::iterator it  = m_chuncks.begin();
-        ptr_vector<char>::iterator end = m_chuncks.end();
-        for (; it != end; ++it) {
-            dealloc_svect(*it);
-        }
-        m_chuncks.reset();
+        del_chuncks(0);
         m_scopes.reset();
     }
 
@@ -56,12 +82,8 @@ public:
     void pop_scope() {
         unsigned old_size = m_scopes.back();
         m_scopes.pop_back();
-        ptr_vector<char>::iterator it  = m_chuncks.begin() + old_size;
-        ptr_vector<char>::iterator end = m_chuncks.end();
-        for (; it != end; ++it) {
-            dealloc_svect(*it);
-        }
-        m_chuncks.shrink(old_size);
+        del_chuncks(old_size);
+        m_num_scopes_popped++;
     }
     
     void pop_scope(unsigned num_scopes) {
@@ -70,6 +92,8 @@ public:
         }
     }
 
+    char const * get_id() const { return m_id; }
+
     void display_mem_stats(std::ostream & out) const;
 };
 
@@ -85,17 +109,34 @@ class region {
         mark * m_prev_mark;
         mark(char * page, char * ptr, mark * m):m_curr_page(page), m_curr_ptr(ptr), m_prev_mark(m) {}
     };
+    // Objects of at most (NUM_SIZE_CLASSES - 1) << PTR_ALIGNMENT bytes released using deallocate
+    // are reused by allocate. The free lists are discarded by pop_scope and reset. So,
+    // an object released in a scope may only be reused in the same scope.
+    static const unsigned NUM_SIZE_CLASSES = 16;
     char *   m_curr_page;
     char *   m_curr_ptr;     //!< Next free space in the current page.
     char *   m_curr_end_ptr; //!< Point to the end of the current page.
     char *   m_free_pages;
     mark *   m_mark;
+    char const * m_id;       //!< Subsystem used for memory accounting.
+    unsigned m_num_free;     //!< Number of objects in m_free_list.
+    void *   m_free_list[NUM_SIZE_CLASSES];
+    // statistics
+    unsigned m_num_pages;          //!< Number of default pages in use.
+    unsigned m_max_num_pages;
+    unsigned m_num_owned_pages;    //!< Number of default pages in use or in m_free_pages.
+    unsigned m_num_scopes_popped;
+    unsigned m_num_released_pages; //!< Number of pages released by pop_scope.
+    unsigned m_num_reused;         //!< Number of objects reused from m_free_list.
     void allocate_page();
     void recycle_curr_page();
+    void reset_free_lists();
+    static unsigned get_size_class(size_t size);
 public:
-    region();
+    region(char const * id = "region");
     ~region();
     void * allocate(size_t size);
+    void deallocate(size_t size, void * p);
     void reset();
     void push_scope();
     void pop_scope();
@@ -104,6 +145,7 @@ public:
             pop_scope();
         }
     }
+    char const * get_id() const { return m_id; }
     void display_mem_stats(std::ostream & out) const;
 };
 
@@ -0,0 +1,450 @@
+/*++
+Copyright (c) 2020 Microsoft Corporation
+
+Module Name:
+
+    robin_hood_hashtable.h
+
+Abstract:
+
+    Hashtable without buckets using Robin Hood linear probing.
+
+    The interface and the entry types are the ones of core_hashtable.
+    So, it can be used as a drop-in replacement for core_hashtable
+    (see the Table template parameter of obj_hashtable and obj_map).
+
+    Differences with respect to core_hashtable:
+    - An entry is stored at most as far from its home slot as the entries
+      it passes when probing. So, the variance of probe lengths is small,
+      and a lookup stops as soon as it reaches an entry closer to its home slot.
+    - Entries are removed using backward shifting. There are no deleted
+      markers (tombstones), and the table does not degrade when it is used
+      with many insert/erase cycles.
+    - Insertions may move existing entries. Pointers to entries (find_core,
+      insert_if_not_there2) are only valid until the next insertion or removal.
+
+--*/
+#pragma once
+
+#include "util/hashtable.h"
+
+template<typename Entry, typename HashProc, typename EqProc>
+class robin_hood_hashtable : private HashProc, private EqProc {
+public:
+    typedef typename Entry::data data;
+    typedef Entry                entry;
+protected:
+    entry *  m_table;
+    unsigned m_capacity;
+    unsigned m_size;
+#ifdef HASHTABLE_STATISTICS
+    unsigned long long m_st_collision;
+#endif
+
+    entry * alloc_table(unsigned size) {
+        return alloc_vect<entry>(size);
+    }
+
+    void delete_table() {
+        dealloc_vect(m_table, m_capacity);
+        m_table = nullptr;
+    }
+
+    unsigned get_hash(data const & e) const { return HashProc::operator()(e); }
+    bool equals(data const & e1, data const & e2) const { return EqProc::operator()(e1, e2); }
+
+    /**
+       \brief Return the distance between the slot idx of the used entry curr and its home slot.
+    */
+    unsigned probe_distance(entry const * curr, unsigned idx) const {
+        return (idx - (curr->get_hash() & (m_capacity - 1))) & (m_capacity - 1);
+    }
+
+    /**
+       \brief Insert the entry e starting at slot idx with probe distance dist.
+       The entry is known not to be in the table. Return the slot where e was stored.
+    */
+    entry * insert_fresh(entry && e, unsigned idx, unsigned dist) {
+        unsigned mask = m_capacity - 1;
+        entry * result = nullptr;
+        entry tmp(std::move(e));
+        while (true) {
+            entry * curr = m_table + idx;
+            if (curr->is_free()) {
+                *curr = std::move(tmp);
+                return result ? result : curr;
+            }
+            unsigned curr_dist = probe_distance(curr, idx);
+            if (curr_dist < dist) {
+                // tmp is further away from its home slot than curr: take its place.
+                std::swap(*curr, tmp);
+                if (!result)
+                    result = curr;
+                dist = curr_dist;
+            }
+            HS_CODE(m_st_collision++;);
+            idx = (idx + 1) & mask;
+            dist++;
+        }
+    }
+
+    void move_table(entry * source, unsigned source_capacity) {
+        unsigned mask = m_capacity - 1;
+        entry * source_end = source + source_capacity;
+        for (entry * curr = source; curr != source_end; ++curr) {
+            if (curr->is_used())
+                insert_fresh(std::move(*curr), curr->get_hash() & mask, 0);
+        }
+    }
+
+    void expand_table() {
+        entry *  old_table    = m_table;
+        unsigned old_capacity = m_capacity;
+        m_capacity = m_capacity << 1;
+        m_table    = alloc_table(m_capacity);
+        move_table(old_table, old_capacity);
+        dealloc_vect(old_table, old_capacity);
+    }
+
+    void expand_if_needed() {
+        if (((m_size + 1) << 2) > (m_capacity * 3))
+            expand_table();
+    }
+
+public:
+    robin_hood_hashtable(unsigned initial_capacity = DEFAULT_HASHTABLE_INITIAL_CAPACITY,
+                         HashProc const & h = HashProc(),
+                         EqProc const & e = EqProc()):
+        HashProc(h),
+        EqProc(e) {
+        SASSERT(is_power_of_two(initial_capacity));
+        m_table    = alloc_table(initial_capacity);
+        m_capacity = initial_capacity;
+        m_size     = 0;
+        HS_CODE({
+            m_st_collision = 0;
+        });
+    }
+
+    robin_hood_hashtable(robin_hood_hashtable const & source):
+        HashProc(source),
+        EqProc(source) {
+        m_capacity = source.m_capacity;
+        m_table    = alloc_table(m_capacity);
+        // the layout of the source is valid for a table with the same capacity.
+        for (unsigned i = 0; i < m_capacity; ++i)
+            if (source.m_table[i].is_used())
+                m_table[i] = source.m_table[i];
+        m_size     = source.m_size;
+        HS_CODE({
+            m_st_collision = 0;
+        });
+    }
+
+    robin_hood_hashtable(robin_hood_hashtable && source) noexcept :
+        HashProc(source),
+        EqProc(source),
+        m_table(nullptr) {
+        m_capacity = source.m_capacity;
+        std::swap(m_table, source.m_table);
+        m_size     = source.m_size;
+        HS_CODE({
+            m_st_collision = 0;
+        });
+    }
+
+    ~robin_hood_hashtable() {
+        delete_table();
+    }
+
+    void swap(robin_hood_hashtable & source) {
+        std::swap(m_table,    source.m_table);
+        std::swap(m_capacity, source.m_capacity);
+        std::swap(m_size,     source.m_size);
+        HS_CODE({
+            std::swap(m_st_collision, source.m_st_collision);
+        });
+    }
+
+    void reset() {
+        if (m_size == 0)
+            return;
+        unsigned overhead = 0;
+        entry * curr      = m_table;
+        entry * end       = m_table + m_capacity;
+        for (; curr != end; ++curr) {
+            if (!curr->is_free())
+                curr->mark_as_free();
+            else
+                overhead++;
+        }
+        if (m_capacity > 16 && overhead << 2 > (m_capacity * 3)) {
+            delete_table();
+            m_capacity = (m_capacity >> 1);
+            SASSERT(is_power_of_two(m_capacity));
+            m_table    = alloc_table(m_capacity);
+        }
+        m_size = 0;
+    }
+
+    void finalize() {
+        if (m_capacity > SMALL_TABLE_CAPACITY) {
+            delete_table();
+            m_table    = alloc_table(SMALL_TABLE_CAPACITY);
+            m_capacity = SMALL_TABLE_CAPACITY;
+            m_size     = 0;
+        }
+        else {
+            reset();
+        }
+    }
+
+    class iterator {
+        entry * m_curr;
+        entry * m_end;
+        void move_to_used() {
+            while (m_curr != m_end && !m_curr->is_used()) {
+                m_curr++;
+            }
+        }
+    public:
+        iterator(entry * start, entry * end): m_curr(start), m_end(end) { move_to_used(); }
+        data & operator*() { return m_curr->get_data(); }
+        data const & operator*() const { return m_curr->get_data(); }
+        data const * operator->() const { return &(operator*()); }
+        data * operator->() { return &(operator*()); }
+        iterator & operator++() { ++m_curr; move_to_used(); return *this; }
+        iterator operator++(int) { iterator tmp = *this; ++*this; return tmp; }
+        bool operator==(iterator const & it) const { return m_curr == it.m_curr; }
+        bool operator!=(iterator const & it) const { return m_curr != it.m_curr; }
+    };
+
+    bool empty() const { return m_size == 0; }
+
+    unsigned size() const { return m_size; }
+
+    unsigned capacity() const { return m_capacity; }
+
+    iterator begin() const { return iterator(m_table, m_table + m_capacity); }
+
+    iterator end() const { return iterator(m_table + m_capacity, m_table + m_capacity); }
+
+protected:
+    /**
+       \brief Return the entry containing e (with hash code hash), or nullptr if e is not in the table.
+       In the latter case, idx and dist are the slot and probe distance where e must be inserted.
+    */
+    entry * find_slot(data const & e, unsigned hash, unsigned & idx, unsigned & dist) const {
+        unsigned mask = m_capacity - 1;
+        idx  = hash & mask;
+        dist = 0;
+        while (true) {
+            entry * curr = m_table + idx;
+            if (curr->is_free())
+                return nullptr;
+            if (curr->get_hash() == hash && equals(curr->get_data(), e))
+                return curr;
+            if (probe_distance(curr, idx) < dist)
+                return nullptr;
+            HS_CODE(const_cast<robin_hood_hashtable*>(this)->m_st_collision++;);
+            idx = (idx + 1) & mask;
+            dist++;
+        }
+    }
+
+    entry * insert_new(data && e, unsigned hash, unsigned idx, unsigned dist) {
+        entry new_entry;
+        new_entry.set_data(std::move(e));
+        new_entry.set_hash(hash);
+        m_size++;
+        return insert_fresh(std::move(new_entry), idx, dist);
+    }
+
+public:
+    void insert(data && e) {
+        expand_if_needed();
+        unsigned hash = get_hash(e);
+        unsigned idx, dist;
+        entry * curr = find_slot(e, hash, idx, dist);
+        if (curr)
+            curr->set_data(std::move(e));
+        else
+            insert_new(std::move(e), hash, idx, dist);
+    }
+
+    void insert(const data & e) {
+        data tmp(e);
+        insert(std::move(tmp));
+    }
+
+    /**
+       \brief Insert the element e if it is not in the table.
+       Return true if it is a new element, and false otherwise.
+       Store the entry/slot of the table in et.
+    */
+    bool insert_if_not_there_core(data && e, entry * & et) {
+        expand_if_needed();
+        unsigned hash = get_hash(e);
+        unsigned idx, dist;
+        et = find_slot(e, hash, idx, dist);
+        if (et)
+            return false;
+        et = insert_new(std::move(e), hash, idx, dist);
+        return true;
+    }
+
+    bool insert_if_not_there_core(const data & e, entry * & et) {
+        data temp(e);
+        return insert_if_not_there_core(std::move(temp), et);
+    }
+
+    data const & insert_if_not_there(data const & e) {
+        entry * et;
+        insert_if_not_there_core(e, et);
+        return et->get_data();
+    }
+
+    entry * insert_if_not_there2(data const & e) {
+        entry * et;
+        insert_if_not_there_core(e, et);
+        return et;
+    }
+
+    entry * find_core(data const & e) const {
+        unsigned idx, dist;
+        return find_slot(e, get_hash(e), idx, dist);
+    }
+
+    bool find(data const & k, data & r) const {
+        entry * e = find_core(k);
+        if (e != nullptr) {
+            r = e->get_data();
+            return true;
+        }
+        return false;
+    }
+
+    bool contains(data const & e) const {
+        return find_core(e) != nullptr;
+    }
+
+    iterator find(data const & e) const {
+        entry * r = find_core(e);
+        if (r) {
+            return iterator(r, m_table + m_capacity);
+        }
+        else {
+            return end();
+        }
+    }
+
+    void remove(data const & e) {
+        entry * curr = find_core(e);
+        if (curr == nullptr)
+            return;
+        // shift the following entries of the cluster one slot back.
+        unsigned mask = m_capacity - 1;
+        unsigned idx  = static_cast<unsigned>(curr - m_table);
+        while (true) {
+            unsigned next_idx = (idx + 1) & mask;
+            entry * next = m_table + next_idx;
+            if (next->is_free() || probe_distance(next, next_idx) == 0)
+                break;
+            *curr = std::move(*next);
+            curr  = next;
+            idx   = next_idx;
+        }
+        curr->mark_as_free();
+        m_size--;
+    }
+
+    void erase(data const & e) { remove(e); }
+
+    void dump(std::ostream & out) {
+        out << "[";
+        bool first = true;
+        for (data const & d : *this) {
+            if (!first)
+                out << " ";
+            first = false;
+            out << d;
+        }
+        out << "]";
+    }
+
+    robin_hood_hashtable & operator|=(robin_hood_hashtable const & other) {
+        if (this == &other) return *this;
+        for (const data & d : other) {
+            insert(d);
+        }
+        return *this;
+    }
+
+    robin_hood_hashtable & operator&=(robin_hood_hashtable const & other) {
+        if (this == &other) return *this;
+        robin_hood_hashtable copy(*this);
+        for (const data & d : copy) {
+            if (!other.contains(d)) {
+                remove(d);
+            }
+        }
+        return *this;
+    }
+
+    robin_hood_hashtable & operator=(robin_hood_hashtable const & other) {
+        if (this == &other) return *this;
+        reset();
+        for (const data & d : other) {
+            insert(d);
+        }
+        return *this;
+    }
+
+#ifdef Z3DEBUG
+    bool check_invariant() {
+        unsigned num_used = 0;
+        for (unsigned idx = 0; idx < m_capacity; ++idx) {
+            entry * curr = m_table + idx;
+            if (curr->is_deleted())
+                return false;
+            if (!curr->is_used())
+                continue;
+            num_used++;
+            // all slots between the home slot and idx are used by entries
+            // that are at least as far from their home slots.
+            unsigned dist = probe_distance(curr, idx);
+            for (unsigned i = 1; i <= dist; ++i) {
+                unsigned prev_idx = (idx - i) & (m_capacity - 1);
+                entry * prev = m_table + prev_idx;
+                SASSERT(prev->is_used());
+                SASSERT(probe_distance(prev, prev_idx) + i >= dist);
+            }
+        }
+        SASSERT(num_used == m_size);
+        return true;
+    }
+#endif
+
+#ifdef HASHTABLE_STATISTICS
+    unsigned long long get_num_collision() const { return m_st_collision; }
+#else
+    unsigned long long get_num_collision() const { return 0; }
+#endif
+
+    void get_collisions(data const & e, vector<data> & collisions) {
+        unsigned hash = get_hash(e);
+        unsigned mask = m_capacity - 1;
+        unsigned idx  = hash & mask;
+        unsigned dist = 0;
+        while (true) {
+            entry * curr = m_table + idx;
+            if (curr->is_free() || probe_distance(curr, idx) < dist)
+                return;
+            if (curr->get_hash() == hash && equals(curr->get_data(), e))
+                return;
+            collisions.push_back(curr->get_data());
+            idx = (idx + 1) & mask;
+            dist++;
+        }
+    }
+};
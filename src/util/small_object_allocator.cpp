@@ -30,9 +30,7 @@ small_object_allocator::small_object_allocator(char const * id) {
         m_chunks[i] = nullptr;
         m_free_list[i] = nullptr;
     }
-    DEBUG_CODE({
-        m_id = id;
-    });
+    m_id = id;
     m_alloc_size = 0;
 }
 
@@ -42,6 +40,7 @@ small_object_allocator::~small_object_allocator() {
         while (c) {
             chunk * next = c->m_next;
             dealloc(c);
+            memory::update_subsystem_usage(m_id, -static_cast<long long>(sizeof(chunk)));
             c = next;
         }
     }
@@ -58,6 +57,7 @@ void small_object_allocator::reset() {
         while (c) {
             chunk * next = c->m_next;
             dealloc(c);
+            memory::update_subsystem_usage(m_id, -static_cast<long long>(sizeof(chunk)));
             c = next;
         }
         m_chunks[i] = nullptr;
@@ -75,6 +75,7 @@ void small_object_allocator::deallocate(size_t size, void * p) {
 #if defined(Z3DEBUG) && !defined(_WINDOWS)
     // Valgrind friendly
     memory::deallocate(p);
+    memory::update_subsystem_usage(m_id, -static_cast<long long>(size));
     return;
 #endif
     SASSERT(m_alloc_size >= size);
@@ -100,6 +101,7 @@ void * small_object_allocator::allocate(size_t size) {
 
 #if defined(Z3DEBUG) && !defined(_WINDOWS)
     // Valgrind friendly
+    memory::update_subsystem_usage(m_id, static_cast<long long>(size));
     return memory::allocate(size);
 #endif
     m_alloc_size += size;
@@ -131,6 +133,7 @@ void * small_object_allocator::allocate(size_t size) {
         }
     }
     chunk * new_c = alloc(chunk);
+    memory::update_subsystem_usage(m_id, static_cast<long long>(sizeof(chunk)));
     new_c->m_next = c;
     m_chunks[slot_id] = new_c;
     void * r = new_c->m_curr;
@@ -220,6 +223,7 @@ void small_object_allocator::consolidate() {
             }
             if (num_free_in_chunk == num_objs_per_chunk) {
                 dealloc(curr_chunk);
+                memory::update_subsystem_usage(m_id, -static_cast<long long>(sizeof(chunk)));
             }
             else {
                 curr_chunk->m_next = last_chunk;
@@ -35,9 +35,7 @@ class small_object_allocator {
     chunk *     m_chunks[NUM_SLOTS];
     void  *     m_free_list[NUM_SLOTS];
     size_t      m_alloc_size;
-#ifdef Z3DEBUG
     char const * m_id;
-#endif
 public:
     small_object_allocator(char const * id = "unknown");
     ~small_object_allocator();
@@ -47,6 +45,7 @@ public:
     size_t get_allocation_size() const { return m_alloc_size; }
     size_t get_wasted_size() const;
     size_t get_num_free_objs() const;
+    char const * get_id() const { return m_id; }
     void consolidate();
 };
 
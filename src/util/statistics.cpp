@@ -21,6 +21,7 @@ Notes:
 #include "util/str_hashtable.h"
 #include "util/buffer.h"
 #include "util/smt2_util.h"
+#include "util/phase_profiler.h"
 #include<iomanip>
 
 void statistics::update(char const * key, unsigned inc) {
@@ -142,6 +143,41 @@ void statistics::display_smt2(std::ostream & out) const {
     out << ")\n";
 }
 
+static void display_json_key(std::ostream & out, char const * key) {
+    SASSERT(key != 0);
+    out << "\"";
+    if (*key == ':')
+        key++;
+    for (; *key; key++) {
+        if (*key == '"' || *key == '\\')
+            out << "\\";
+        out << *key;
+    }
+    out << "\"";
+}
+
+void statistics::display_json(std::ostream & out) const {
+    INIT_DISPLAY();
+    (void)max;
+    out << "{";
+    for (unsigned i = 0; i < keys.size(); i++) {
+        char * k = keys.get(i);
+        out << (i == 0 ? "\n  " : ",\n  ");
+        display_json_key(out, k);
+        out << ": ";
+        unsigned val; 
+        if (m_u.find(k, val)) {
+            out << val;
+        }
+        else {
+            double d_val = 0.0;
+            m_d.find(k, d_val);
+            out << std::fixed << std::setprecision(2) << d_val;
+        }
+    }
+    out << "\n}\n";
+}
+
 void statistics::display(std::ostream & out) const {
     INIT_DISPLAY();
 
@@ -244,6 +280,7 @@ void get_memory_statistics(statistics& st) {
     st.update("max memory", static_cast<double>(max_mem)/100.0);    
     st.update("memory", static_cast<double>(mem)/100.0);
     get_uint64_stats(st, "num allocs",  memory::get_allocation_count());
+    phase_profiler::collect_statistics(st);
 }
 
 void get_rlimit_statistics(reslimit& l, statistics& st) {